@@ -0,0 +1,134 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+using namespace duckdb;
+
+//===--------------------------------------------------------------------===//
+// Kernel-isolating benchmarks: each query is shaped so that a single core
+// kernel dominates its runtime, so kernel regressions can be bisected here
+// instead of showing up as end-to-end drift.
+//===--------------------------------------------------------------------===//
+
+//===--------------------------------------------------------------------===//
+// JoinHashTable probe
+//===--------------------------------------------------------------------===//
+DUCKDB_BENCHMARK(KernelHashJoinProbe, "[kernels]")
+void Load(DuckDBBenchmarkState *state) override {
+	// small-ish build side, large probe side: runtime is dominated by the probe loop
+	state->conn.Query("CREATE TABLE build AS SELECT i * 7 AS k, i AS v FROM range(1000000) t(i)");
+	state->conn.Query("CREATE TABLE probe AS SELECT i % 7000000 AS k FROM range(20000000) t(i)");
+}
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	state->result = state->conn.Query("SELECT COUNT(*), SUM(v) FROM probe JOIN build USING (k)");
+}
+string VerifyResult(QueryResult *result) override {
+	auto &materialized = (MaterializedQueryResult &)*result;
+	if (materialized.HasError()) {
+		return materialized.GetError();
+	}
+	return string();
+}
+string BenchmarkInfo() override {
+	return "Probe-heavy hash join isolating the JoinHashTable probe loop";
+}
+FINISH_BENCHMARK(KernelHashJoinProbe)
+
+//===--------------------------------------------------------------------===//
+// Radix partitioning / aggregate hash table
+//===--------------------------------------------------------------------===//
+DUCKDB_BENCHMARK(KernelRadixPartitioning, "[kernels]")
+void Load(DuckDBBenchmarkState *state) override {
+	// high-cardinality group by: radix partitioning and HT insertion dominate
+	state->conn.Query("CREATE TABLE facts AS SELECT hash(i) % 10000000 AS k, i AS v FROM range(20000000) t(i)");
+}
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	state->result = state->conn.Query("SELECT COUNT(*) FROM (SELECT k, SUM(v) FROM facts GROUP BY k)");
+}
+string VerifyResult(QueryResult *result) override {
+	auto &materialized = (MaterializedQueryResult &)*result;
+	if (materialized.HasError()) {
+		return materialized.GetError();
+	}
+	return string();
+}
+string BenchmarkInfo() override {
+	return "High-cardinality aggregation isolating radix partitioning";
+}
+FINISH_BENCHMARK(KernelRadixPartitioning)
+
+//===--------------------------------------------------------------------===//
+// Bitpacking codec
+//===--------------------------------------------------------------------===//
+DUCKDB_BENCHMARK(KernelBitpacking, "[kernels]")
+void Load(DuckDBBenchmarkState *state) override {
+	state->conn.Query("PRAGMA force_compression='bitpacking'");
+	// small domain so every segment bitpacks; scan decompression isolates the codec
+	state->conn.Query("CREATE TABLE packed AS SELECT (i % 1024)::INTEGER AS a, (i % 31)::INTEGER AS b "
+	                  "FROM range(50000000) t(i)");
+	state->conn.Query("CHECKPOINT");
+}
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	state->result = state->conn.Query("SELECT SUM(a), SUM(b) FROM packed");
+}
+string VerifyResult(QueryResult *result) override {
+	auto &materialized = (MaterializedQueryResult &)*result;
+	if (materialized.HasError()) {
+		return materialized.GetError();
+	}
+	return string();
+}
+string BenchmarkInfo() override {
+	return "Scan over bitpacked segments isolating the bitpacking decode kernel";
+}
+FINISH_BENCHMARK(KernelBitpacking)
+
+//===--------------------------------------------------------------------===//
+// ValidityMask operations
+//===--------------------------------------------------------------------===//
+DUCKDB_BENCHMARK(KernelValidityMask, "[kernels]")
+void Load(DuckDBBenchmarkState *state) override {
+	// half the rows NULL in an alternating pattern: validity mask reads/writes dominate
+	state->conn.Query("CREATE TABLE nullish AS SELECT CASE WHEN i % 2 = 0 THEN i END AS v "
+	                  "FROM range(50000000) t(i)");
+}
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	state->result = state->conn.Query("SELECT COUNT(v), SUM(v) FROM nullish");
+}
+string VerifyResult(QueryResult *result) override {
+	auto &materialized = (MaterializedQueryResult &)*result;
+	if (materialized.HasError()) {
+		return materialized.GetError();
+	}
+	return string();
+}
+string BenchmarkInfo() override {
+	return "NULL-heavy aggregation isolating ValidityMask operations";
+}
+FINISH_BENCHMARK(KernelValidityMask)
+
+//===--------------------------------------------------------------------===//
+// CSV state machine
+//===--------------------------------------------------------------------===//
+DUCKDB_BENCHMARK(KernelCSVStateMachine, "[kernels]")
+void Load(DuckDBBenchmarkState *state) override {
+	state->conn.Query("COPY (SELECT i, 'value_' || i AS s, i * 0.5 AS f FROM range(10000000) t(i)) "
+	                  "TO '" +
+	                  GetCSVPath() + "' (HEADER)");
+}
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	state->result = state->conn.Query("SELECT COUNT(*) FROM read_csv('" + GetCSVPath() + "')");
+}
+string VerifyResult(QueryResult *result) override {
+	auto &materialized = (MaterializedQueryResult &)*result;
+	if (materialized.HasError()) {
+		return materialized.GetError();
+	}
+	return string();
+}
+string BenchmarkInfo() override {
+	return "CSV scan isolating the state machine and value parsing";
+}
+static string GetCSVPath() {
+	return "duckdb_kernel_benchmark.csv";
+}
+FINISH_BENCHMARK(KernelCSVStateMachine)
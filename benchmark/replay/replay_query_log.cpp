@@ -0,0 +1,183 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/common/printer.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+using namespace duckdb;
+
+//===--------------------------------------------------------------------===//
+// Query log replay: re-runs a logged workload with its original concurrency.
+//
+// The log is a tab-separated file set through the DUCKDB_REPLAY_LOG environment
+// variable, one entry per line:
+//
+//     <connection id>\t<arrival offset in ms>\t<sql>
+//
+// Each connection id becomes a thread with its own connection; every entry is
+// issued at its original offset relative to the start of the replay, so
+// scheduler fairness and buffer pool interactions are reproduced rather than
+// serialized away. Without DUCKDB_REPLAY_LOG, a synthetic mixed workload is
+// replayed so the harness itself is exercised in CI.
+//
+// Setup statements can be provided in a companion file (same path with a
+// ".setup" suffix), executed serially before the replay starts.
+//===--------------------------------------------------------------------===//
+
+namespace {
+
+struct ReplayEntry {
+	idx_t connection_id;
+	int64_t offset_ms;
+	string sql;
+};
+
+struct ReplayLog {
+	vector<string> setup_queries;
+	vector<ReplayEntry> entries;
+};
+
+ReplayLog LoadReplayLog() {
+	ReplayLog log;
+	const char *path = std::getenv("DUCKDB_REPLAY_LOG");
+	if (!path) {
+		// synthetic default: four connections interleaving scans, aggregations and point lookups
+		log.setup_queries.push_back("CREATE TABLE replay_facts AS SELECT i AS id, i % 1000 AS g, i * 2 AS v "
+		                            "FROM range(2000000) t(i)");
+		const char *queries[] = {"SELECT SUM(v) FROM replay_facts",
+		                         "SELECT g, COUNT(*) FROM replay_facts GROUP BY g ORDER BY g LIMIT 5",
+		                         "SELECT * FROM replay_facts WHERE id = 123456",
+		                         "SELECT COUNT(*) FROM replay_facts WHERE g < 100"};
+		for (idx_t connection_id = 0; connection_id < 4; connection_id++) {
+			for (idx_t i = 0; i < 8; i++) {
+				ReplayEntry entry;
+				entry.connection_id = connection_id;
+				entry.offset_ms = NumericCast<int64_t>(i * 25 + connection_id * 5);
+				entry.sql = queries[(connection_id + i) % 4];
+				log.entries.push_back(std::move(entry));
+			}
+		}
+		return log;
+	}
+	std::ifstream setup_file(string(path) + ".setup");
+	if (setup_file.is_open()) {
+		string line;
+		while (std::getline(setup_file, line)) {
+			if (!line.empty()) {
+				log.setup_queries.push_back(line);
+			}
+		}
+	}
+	std::ifstream log_file(path);
+	if (!log_file.is_open()) {
+		throw IOException("Could not open replay log \"%s\"", string(path));
+	}
+	string line;
+	idx_t line_number = 0;
+	while (std::getline(log_file, line)) {
+		line_number++;
+		if (line.empty()) {
+			continue;
+		}
+		auto parts = StringUtil::Split(line, '\t');
+		if (parts.size() < 3) {
+			throw IOException("Replay log line %llu is malformed (expected connection id, offset, sql)", line_number);
+		}
+		ReplayEntry entry;
+		entry.connection_id = NumericCast<idx_t>(std::stoll(parts[0]));
+		entry.offset_ms = std::stoll(parts[1]);
+		// the sql itself may contain tabs - rejoin the remainder
+		entry.sql = parts[2];
+		for (idx_t i = 3; i < parts.size(); i++) {
+			entry.sql += "\t" + parts[i];
+		}
+		log.entries.push_back(std::move(entry));
+	}
+	return log;
+}
+
+void ReplayConnection(DuckDB *db, const vector<ReplayEntry> *entries,
+                      std::chrono::steady_clock::time_point replay_start, vector<double> *latencies_ms,
+                      string *error) {
+	Connection con(*db);
+	for (auto &entry : *entries) {
+		std::this_thread::sleep_until(replay_start + std::chrono::milliseconds(entry.offset_ms));
+		auto query_start = std::chrono::steady_clock::now();
+		auto result = con.Query(entry.sql);
+		auto query_end = std::chrono::steady_clock::now();
+		if (result->HasError()) {
+			*error = result->GetError();
+			return;
+		}
+		latencies_ms->push_back(std::chrono::duration<double, std::milli>(query_end - query_start).count());
+	}
+}
+
+double Percentile(vector<double> &sorted_latencies, double fraction) {
+	if (sorted_latencies.empty()) {
+		return 0;
+	}
+	auto pos = LossyNumericCast<idx_t>(fraction * static_cast<double>(sorted_latencies.size() - 1));
+	return sorted_latencies[pos];
+}
+
+} // namespace
+
+DUCKDB_BENCHMARK(QueryLogReplay, "[replay]")
+void Load(DuckDBBenchmarkState *state) override {
+	auto log = LoadReplayLog();
+	for (auto &setup : log.setup_queries) {
+		auto result = state->conn.Query(setup);
+		if (result->HasError()) {
+			throw IOException("Replay setup query failed: %s", result->GetError());
+		}
+	}
+	// bucket the entries per connection, retaining the original order
+	replay_connections.clear();
+	for (auto &entry : log.entries) {
+		replay_connections[entry.connection_id].push_back(entry);
+	}
+}
+void RunBenchmark(DuckDBBenchmarkState *state) override {
+	vector<std::thread> threads;
+	vector<vector<double>> latencies(replay_connections.size());
+	vector<string> errors(replay_connections.size());
+	auto replay_start = std::chrono::steady_clock::now();
+	idx_t thread_idx = 0;
+	for (auto &entry : replay_connections) {
+		threads.emplace_back(ReplayConnection, &state->db, &entry.second, replay_start, &latencies[thread_idx],
+		                     &errors[thread_idx]);
+		thread_idx++;
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	replay_error = string();
+	vector<double> all_latencies;
+	for (idx_t i = 0; i < latencies.size(); i++) {
+		if (!errors[i].empty()) {
+			replay_error = errors[i];
+		}
+		all_latencies.insert(all_latencies.end(), latencies[i].begin(), latencies[i].end());
+	}
+	std::sort(all_latencies.begin(), all_latencies.end());
+	Printer::Print(StringUtil::Format("replayed %llu queries over %llu connections: "
+	                                  "p50 %.2fms, p95 %.2fms, p99 %.2fms, max %.2fms",
+	                                  all_latencies.size(), replay_connections.size(),
+	                                  Percentile(all_latencies, 0.50), Percentile(all_latencies, 0.95),
+	                                  Percentile(all_latencies, 0.99), Percentile(all_latencies, 1.0)));
+}
+string VerifyResult(QueryResult *result) override {
+	return replay_error;
+}
+string BenchmarkInfo() override {
+	return "Replays a production query log (DUCKDB_REPLAY_LOG) with its original concurrency";
+}
+map<idx_t, vector<ReplayEntry>> replay_connections;
+string replay_error;
+FINISH_BENCHMARK(QueryLogReplay)
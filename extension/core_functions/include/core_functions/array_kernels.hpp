@@ -8,23 +8,35 @@ namespace duckdb {
 //-------------------------------------------------------------------------
 // Folding Operations
 //-------------------------------------------------------------------------
+//! The number of independent accumulator lanes in the distance kernels below. A single floating-point
+//! accumulator serializes the reduction (the compiler may not reassociate FP additions), so the loops
+//! explicitly accumulate into LANES independent partial sums, which pipelines and vectorizes on any
+//! ISA without intrinsics. Folding the lanes changes the summation order, which is permitted here -
+//! these kernels compute distances, not exact sums.
+static constexpr idx_t ARRAY_KERNEL_LANES = 8;
+
 struct InnerProductOp {
 	static constexpr bool ALLOW_EMPTY = true;
 
 	template <class TYPE>
 	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
 
-		TYPE result = 0;
-
-		auto lhs_ptr = lhs_data;
-		auto rhs_ptr = rhs_data;
+		TYPE partial[ARRAY_KERNEL_LANES] = {0};
 
-		for (idx_t i = 0; i < count; i++) {
-			const auto x = *lhs_ptr++;
-			const auto y = *rhs_ptr++;
-			result += x * y;
+		idx_t i = 0;
+		for (; i + ARRAY_KERNEL_LANES <= count; i += ARRAY_KERNEL_LANES) {
+			for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+				partial[lane] += lhs_data[i + lane] * rhs_data[i + lane];
+			}
 		}
 
+		TYPE result = 0;
+		for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+			result += partial[lane];
+		}
+		for (; i < count; i++) {
+			result += lhs_data[i] * rhs_data[i];
+		}
 		return result;
 	}
 };
@@ -44,16 +56,32 @@ struct CosineSimilarityOp {
 	template <class TYPE>
 	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
 
+		TYPE partial_dist[ARRAY_KERNEL_LANES] = {0};
+		TYPE partial_norm_l[ARRAY_KERNEL_LANES] = {0};
+		TYPE partial_norm_r[ARRAY_KERNEL_LANES] = {0};
+
+		idx_t i = 0;
+		for (; i + ARRAY_KERNEL_LANES <= count; i += ARRAY_KERNEL_LANES) {
+			for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+				const auto x = lhs_data[i + lane];
+				const auto y = rhs_data[i + lane];
+				partial_dist[lane] += x * y;
+				partial_norm_l[lane] += x * x;
+				partial_norm_r[lane] += y * y;
+			}
+		}
+
 		TYPE distance = 0;
 		TYPE norm_l = 0;
 		TYPE norm_r = 0;
-
-		auto l_ptr = lhs_data;
-		auto r_ptr = rhs_data;
-
-		for (idx_t i = 0; i < count; i++) {
-			const auto x = *l_ptr++;
-			const auto y = *r_ptr++;
+		for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+			distance += partial_dist[lane];
+			norm_l += partial_norm_l[lane];
+			norm_r += partial_norm_r[lane];
+		}
+		for (; i < count; i++) {
+			const auto x = lhs_data[i];
+			const auto y = rhs_data[i];
 			distance += x * y;
 			norm_l += x * x;
 			norm_r += y * y;
@@ -79,18 +107,24 @@ struct DistanceSquaredOp {
 	template <class TYPE>
 	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
 
-		TYPE distance = 0;
+		TYPE partial[ARRAY_KERNEL_LANES] = {0};
 
-		auto l_ptr = lhs_data;
-		auto r_ptr = rhs_data;
+		idx_t i = 0;
+		for (; i + ARRAY_KERNEL_LANES <= count; i += ARRAY_KERNEL_LANES) {
+			for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+				const auto diff = lhs_data[i + lane] - rhs_data[i + lane];
+				partial[lane] += diff * diff;
+			}
+		}
 
-		for (idx_t i = 0; i < count; i++) {
-			const auto x = *l_ptr++;
-			const auto y = *r_ptr++;
-			const auto diff = x - y;
+		TYPE distance = 0;
+		for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+			distance += partial[lane];
+		}
+		for (; i < count; i++) {
+			const auto diff = lhs_data[i] - rhs_data[i];
 			distance += diff * diff;
 		}
-
 		return distance;
 	}
 };
@@ -291,6 +291,75 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 	// get the expression executor
 	LambdaExecuteInfo execute_info(state.GetContext(), *info.lambda_expr, args, info.has_index, *info.child_vector);
 
+	// fast path: no index parameter, no inconstant captured columns, and the list entries cover the
+	// child vector contiguously and in order. Then the lambda can execute directly on contiguous
+	// slices of the child vector, and we skip materializing a selection vector per element
+	if (!info.has_index && mutable_column_infos.empty()) {
+		idx_t contiguous_elem_count = 0;
+		bool is_contiguous = true;
+		for (idx_t row_idx = 0; row_idx < info.row_count; row_idx++) {
+			auto list_idx = info.list_column_format.sel->get_index(row_idx);
+			if (!info.list_column_format.validity.RowIsValid(list_idx)) {
+				continue;
+			}
+			const auto &list_entry = info.list_entries[list_idx];
+			if (list_entry.offset != contiguous_elem_count) {
+				is_contiguous = false;
+				break;
+			}
+			contiguous_elem_count += list_entry.length;
+		}
+
+		if (is_contiguous) {
+			// set the result entries (and the result validity) for all rows
+			idx_t offset = 0;
+			ListFilterInfo list_filter_info;
+			FUNCTION_FUNCTOR::ReserveNewLengths(list_filter_info.entry_lengths, info.row_count);
+			for (idx_t row_idx = 0; row_idx < info.row_count; row_idx++) {
+				auto list_idx = info.list_column_format.sel->get_index(row_idx);
+				if (!info.list_column_format.validity.RowIsValid(list_idx)) {
+					info.result_validity->SetInvalid(row_idx);
+					FUNCTION_FUNCTOR::PushEmptyList(list_filter_info.entry_lengths);
+					continue;
+				}
+				FUNCTION_FUNCTOR::SetResultEntry(result_entries, offset, info.list_entries[list_idx], row_idx,
+				                                 list_filter_info.entry_lengths);
+			}
+
+			// execute the lambda expression over contiguous slices of the child vector
+			idx_t elem_offset = 0;
+			while (true) {
+				auto elem_cnt = MinValue<idx_t>(contiguous_elem_count - elem_offset, STANDARD_VECTOR_SIZE);
+
+				execute_info.lambda_chunk.Reset();
+				execute_info.input_chunk.SetCardinality(elem_cnt);
+				execute_info.lambda_chunk.SetCardinality(elem_cnt);
+
+				Vector child_slice(*info.child_vector, elem_offset, elem_offset + elem_cnt);
+				execute_info.input_chunk.data[0].Reference(child_slice);
+				for (idx_t i = 0; i < info.column_infos.size(); i++) {
+					// only constant columns remain on this path
+					execute_info.input_chunk.data[i + 1].Reference(info.column_infos[i].vector);
+				}
+				execute_info.expr_executor->Execute(execute_info.input_chunk, execute_info.lambda_chunk);
+
+				auto &lambda_vector = execute_info.lambda_chunk.data[0];
+				FUNCTION_FUNCTOR::AppendResult(result, lambda_vector, elem_cnt, result_entries, list_filter_info,
+				                               execute_info);
+
+				elem_offset += elem_cnt;
+				if (elem_offset >= contiguous_elem_count) {
+					break;
+				}
+			}
+
+			if (info.is_all_constant && !info.is_volatile) {
+				result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			}
+			return;
+		}
+	}
+
 	// get list_filter specific info
 	ListFilterInfo list_filter_info;
 	FUNCTION_FUNCTOR::ReserveNewLengths(list_filter_info.entry_lengths, info.row_count);
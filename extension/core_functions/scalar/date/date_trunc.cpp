@@ -151,6 +151,40 @@ struct DateTrunc {
 	};
 };
 
+// Sub-day buckets do not need the date/time decomposition of the generic operators: day boundaries
+// are whole multiples of every sub-day bucket width, so flooring the epoch microseconds to a multiple
+// of the bucket width yields the same result with a single division
+static inline timestamp_t TruncateTimestampToMicros(timestamp_t input, int64_t bucket_width) {
+	if (DUCKDB_UNLIKELY(!Timestamp::IsFinite(input))) {
+		return input;
+	}
+	auto remainder = input.value % bucket_width;
+	if (remainder < 0) {
+		remainder += bucket_width;
+	}
+	return timestamp_t(input.value - remainder);
+}
+
+template <>
+timestamp_t DateTrunc::HourOperator::Operation(timestamp_t input) {
+	return TruncateTimestampToMicros(input, Interval::MICROS_PER_HOUR);
+}
+
+template <>
+timestamp_t DateTrunc::MinuteOperator::Operation(timestamp_t input) {
+	return TruncateTimestampToMicros(input, Interval::MICROS_PER_MINUTE);
+}
+
+template <>
+timestamp_t DateTrunc::SecondOperator::Operation(timestamp_t input) {
+	return TruncateTimestampToMicros(input, Interval::MICROS_PER_SEC);
+}
+
+template <>
+timestamp_t DateTrunc::MillisecondOperator::Operation(timestamp_t input) {
+	return TruncateTimestampToMicros(input, Interval::MICROS_PER_MSEC);
+}
+
 // DATE specialisations
 template <>
 date_t DateTrunc::MillenniumOperator::Operation(timestamp_t input) {
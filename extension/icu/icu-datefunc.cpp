@@ -10,6 +10,12 @@
 
 namespace duckdb {
 
+// The calendar object is created once per expression state and reused across all values of all
+// vectors, so per-value cost is a setTime plus field reads, not object construction. Replacing the
+// calendar with a pre-materialized timezone transition table would be faster still for the common
+// case, but is only correct for the default Gregorian calendar - the Calendar setting allows
+// non-Gregorian calendars whose field math cannot be reproduced from UTC offsets alone - so such a
+// cache would have to be a Gregorian-only fast path that bypasses ICU, not a replacement.
 ICUDateFunc::BindData::BindData(const BindData &other)
     : tz_setting(other.tz_setting), cal_setting(other.cal_setting), calendar(other.calendar->clone()) {
 }
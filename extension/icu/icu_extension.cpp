@@ -132,6 +132,12 @@ static int32_t ICUGetSortKey(icu::Collator &collator, string_t input, duckdb::un
 	return string_size;
 }
 
+// Collation costs are paid once per row, not once per comparison: the collation binder rewrites the
+// sort/comparison expression to this function, so the sort operates on the returned byte-comparable
+// key through its regular radix key normalization (including prefix truncation with comparison
+// fallback). The hex encoding below exists because ICU sort keys are arbitrary bytes and VARCHAR
+// requires valid UTF-8 - it doubles the key size, and removing that factor means teaching the
+// collation pipeline to carry BLOB-typed keys instead.
 static void ICUCollateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	const char HEX_TABLE[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
 
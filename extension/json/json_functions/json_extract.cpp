@@ -35,6 +35,10 @@ static void ExtractStringManyFunction(DataChunk &args, ExpressionState &state, V
 	JSONExecutors::ExecuteMany<string_t>(args, state, result, ExtractStringFromVal);
 }
 
+// In addition to the single-path variants, json_extract accepts a LIST of paths: the document is then
+// parsed ONCE and all paths are resolved against the same parse tree (see ExecuteMany). Queries that
+// read several fields from the same document should prefer json_extract(j, ['$.a', '$.b']) over
+// separate calls, which each re-parse the document.
 static void GetExtractFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type, LogicalType::BIGINT}, LogicalType::JSON(), ExtractFunction,
 	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
@@ -93,15 +93,18 @@ private:
 			const idx_t next = MinValue(batch_size - target_values_offset,
 			                            BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE - unpacked_data_offset);
 			if (next != 0) {
+				// accumulate in a single full-width register: truncating to T only when storing is
+				// congruent to truncating every step (addition commutes with the modulo), and it keeps
+				// the loop body down to one add-chain that the compiler can keep in registers
+				auto running_value = static_cast<uint64_t>(previous_value);
+				const auto delta = static_cast<uint64_t>(min_delta);
 				for (idx_t i = 0; i < next; i++) {
-					const auto &unpacked_value = unpacked_data[unpacked_data_offset + i];
-					auto current_value = static_cast<T>(static_cast<uint64_t>(previous_value) +
-					                                    static_cast<uint64_t>(min_delta) + unpacked_value);
+					running_value += delta + unpacked_data[unpacked_data_offset + i];
 					if (!SKIP_READ) {
-						target_values[target_values_offset + i] = current_value;
+						target_values[target_values_offset + i] = static_cast<T>(running_value);
 					}
-					previous_value = static_cast<int64_t>(current_value);
 				}
+				previous_value = static_cast<int64_t>(static_cast<T>(running_value));
 				target_values_offset += next;
 				unpacked_data_offset += next;
 				continue;
@@ -35,6 +35,7 @@ public:
 public:
 	static string ObjectType();
 	string GetObjectType() override;
+	idx_t GetObjectSize() override;
 
 	bool IsValid(CachingFileHandle &new_handle) const;
 	//! Check if a cache entry is valid based ONLY on the OpenFileInfo (without doing any file system calls)
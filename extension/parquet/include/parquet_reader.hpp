@@ -14,6 +14,7 @@
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/multi_file/base_file_reader.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/common/multi_file/multi_file_options.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -64,6 +65,21 @@ struct ParquetReaderScanState {
 	unique_ptr<ColumnReader> root_reader;
 	std::unique_ptr<duckdb_apache::thrift::protocol::TProtocol> thrift_file_proto;
 
+	//! Whether the top-level columns of each row group are decoded in parallel (single giant row group)
+	bool parallel_column_decode = false;
+	//! Per-top-level-column file handles and protocols, used when parallel_column_decode is set
+	vector<unique_ptr<CachingFileHandle>> column_file_handles;
+	vector<std::unique_ptr<duckdb_apache::thrift::protocol::TProtocol>> column_file_protocols;
+	//! Re-used executor for the parallel column decoding tasks
+	unique_ptr<TaskExecutor> decode_executor;
+
+	//! Whether page-level pruning (via the parquet column index) is active for the current row group
+	bool page_pruning_active = false;
+	//! The surviving row ranges of the current row group (relative to the row group start, sorted)
+	vector<pair<idx_t, idx_t>> surviving_row_ranges;
+	//! The index of the surviving row range the scan cursor is in (or before)
+	idx_t current_surviving_range = 0;
+
 	bool finished;
 	SelectionVector sel;
 
@@ -216,6 +232,7 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	void ComputePagePruneRanges(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter);
 	ParquetColumnSchema ParseColumnSchema(const SchemaElement &s_ele, idx_t max_define, idx_t max_repeat,
 	                                      idx_t schema_index, idx_t column_index,
 	                                      ParquetColumnSchemaType type = ParquetColumnSchemaType::COLUMN);
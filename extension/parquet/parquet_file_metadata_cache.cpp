@@ -19,6 +19,11 @@ string ParquetFileMetadataCache::GetObjectType() {
 	return ObjectType();
 }
 
+idx_t ParquetFileMetadataCache::GetObjectSize() {
+	// the deserialized metadata is roughly proportional to the footer it was read from
+	return footer_size;
+}
+
 bool ParquetFileMetadataCache::IsValid(CachingFileHandle &new_handle) const {
 	return ExternalFileCache::IsValid(validate, version_tag, last_modified, new_handle.GetVersionTag(),
 	                                  new_handle.GetLastModifiedTime());
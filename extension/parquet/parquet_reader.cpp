@@ -18,6 +18,8 @@
 #include "reader/templated_column_reader.hpp"
 #include "thrift_tools.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/helper.hpp"
@@ -1020,6 +1022,124 @@ static FilterPropagateResult CheckParquetFloatFilter(ColumnReader &reader, const
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+//! Evaluate a table filter against the min/max of a single page (mirrors the row-group pruning above)
+static FilterPropagateResult CheckPageFilter(ColumnReader &column_reader, TableFilter &filter,
+                                             vector<duckdb_parquet::ColumnChunk> &page_columns,
+                                             const duckdb_parquet::ColumnIndex &column_index, idx_t page_idx) {
+	if (page_idx < column_index.null_pages.size() && column_index.null_pages[page_idx]) {
+		// the page only contains NULL values - be conservative
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (page_idx >= column_index.min_values.size() || page_idx >= column_index.max_values.size()) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// fabricate column statistics for this page, then re-use the row-group pruning machinery
+	auto &page_stats = page_columns[column_reader.ColumnIndex()].meta_data.statistics;
+	page_stats.__isset.min_value = true;
+	page_stats.__isset.max_value = true;
+	page_stats.min_value = column_index.min_values[page_idx];
+	page_stats.max_value = column_index.max_values[page_idx];
+	page_stats.__isset.null_count = column_index.__isset.null_counts && page_idx < column_index.null_counts.size();
+	if (page_stats.__isset.null_count) {
+		page_stats.null_count = column_index.null_counts[page_idx];
+	}
+	auto stats = ParquetStatisticsUtils::TransformColumnStatistics(column_reader.Schema(), page_columns);
+	if (!stats) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (column_reader.Type().id() == LogicalTypeId::VARCHAR) {
+		return CheckParquetStringFilter(*stats, page_stats, filter);
+	}
+	if (column_reader.Type().id() == LogicalTypeId::FLOAT || column_reader.Type().id() == LogicalTypeId::DOUBLE) {
+		return CheckParquetFloatFilter(column_reader, page_stats, filter);
+	}
+	return filter.CheckStatistics(*stats);
+}
+
+//! Intersect two sorted row range lists
+static vector<pair<idx_t, idx_t>> IntersectRowRanges(const vector<pair<idx_t, idx_t>> &a,
+                                                     const vector<pair<idx_t, idx_t>> &b) {
+	vector<pair<idx_t, idx_t>> result;
+	idx_t ai = 0;
+	idx_t bi = 0;
+	while (ai < a.size() && bi < b.size()) {
+		const auto range_start = MaxValue(a[ai].first, b[bi].first);
+		const auto range_end = MinValue(a[ai].second, b[bi].second);
+		if (range_start < range_end) {
+			result.emplace_back(range_start, range_end);
+		}
+		if (a[ai].second < b[bi].second) {
+			ai++;
+		} else {
+			bi++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::ComputePagePruneRanges(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                           TableFilter &filter) {
+	auto &group = GetGroup(state);
+	if (parquet_options.encryption_config) {
+		return;
+	}
+	if (column_reader.Schema().schema_type != ParquetColumnSchemaType::COLUMN || column_reader.Type().IsNested()) {
+		return;
+	}
+	if (column_reader.ColumnIndex() >= group.columns.size()) {
+		return;
+	}
+	auto &chunk_meta = group.columns[column_reader.ColumnIndex()];
+	if (!chunk_meta.__isset.column_index_offset || !chunk_meta.__isset.offset_index_offset) {
+		return;
+	}
+	try {
+		auto &transport = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+		duckdb_parquet::ColumnIndex column_index;
+		transport.SetLocation(NumericCast<idx_t>(chunk_meta.column_index_offset));
+		column_index.read(state.thrift_file_proto.get());
+		duckdb_parquet::OffsetIndex offset_index;
+		transport.SetLocation(NumericCast<idx_t>(chunk_meta.offset_index_offset));
+		offset_index.read(state.thrift_file_proto.get());
+
+		auto &pages = offset_index.page_locations;
+		if (pages.size() <= 1 || column_index.min_values.size() != pages.size()) {
+			return;
+		}
+
+		// evaluate the filter against every page, merging the surviving pages into row ranges
+		auto page_columns = group.columns;
+		vector<pair<idx_t, idx_t>> ranges;
+		for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+			const auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+			const auto page_end = page_idx + 1 < pages.size()
+			                          ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index)
+			                          : NumericCast<idx_t>(group.num_rows);
+			if (CheckPageFilter(column_reader, filter, page_columns, column_index, page_idx) ==
+			    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				// no row in this page can match the filter
+				continue;
+			}
+			if (!ranges.empty() && ranges.back().second == page_start) {
+				ranges.back().second = page_end;
+			} else {
+				ranges.emplace_back(page_start, page_end);
+			}
+		}
+		if (!state.page_pruning_active) {
+			state.page_pruning_active = true;
+			state.surviving_row_ranges = std::move(ranges);
+		} else {
+			state.surviving_row_ranges = IntersectRowRanges(state.surviving_row_ranges, ranges);
+		}
+		state.current_surviving_range = 0;
+	} catch (...) { // LCOV_EXCL_START
+		// a corrupt or unreadable page index never fails the scan - we simply do not prune
+		state.page_pruning_active = false;
+		state.surviving_row_ranges.clear();
+	} // LCOV_EXCL_STOP
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t i) {
 	auto &group = GetGroup(state);
 	auto col_idx = MultiFileLocalIndex(i);
@@ -1062,7 +1182,8 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t i
 			} else {
 				prune_result = filter.CheckStatistics(*stats);
 			}
-			// check the bloom filter if present
+			// check the bloom filter if present - this is what prunes row groups for point lookups on
+			// high-cardinality columns, where min/max statistics are too wide to exclude anything
 			if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE && !column_reader.Type().IsNested() &&
 			    is_column && ParquetStatisticsUtils::BloomFilterSupported(column_reader.Type().id()) &&
 			    ParquetStatisticsUtils::BloomFilterExcludes(filter,
@@ -1076,9 +1197,32 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t i
 				state.offset_in_group = group.num_rows;
 				return;
 			}
+			// the row group survives - check the page-level column index (if present) to compute which
+			// row ranges of the row group can contain filter matches
+			ComputePagePruneRanges(state, column_reader, filter);
 		}
 	}
 
+	if (state.parallel_column_decode) {
+		// set up one file handle and protocol per top-level column, so that the columns can be decoded by
+		// separate threads without sharing transport state. this function runs once per projected column,
+		// but the setup covers all columns - only do it on the first call (there is only one row group)
+		if (!state.column_file_protocols.empty()) {
+			return;
+		}
+		auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+		for (auto &child : root_reader.child_readers) {
+			if (!child) {
+				continue;
+			}
+			auto column_handle = fs.OpenFile(file, FileFlags::FILE_FLAGS_READ);
+			auto column_proto = CreateThriftFileProtocol(*column_handle, false);
+			child->InitializeRead(state.group_idx_list[state.current_group], group.columns, *column_proto);
+			state.column_file_handles.push_back(std::move(column_handle));
+			state.column_file_protocols.push_back(std::move(column_proto));
+		}
+		return;
+	}
 	state.root_reader->InitializeRead(state.group_idx_list[state.current_group], group.columns,
 	                                  *state.thrift_file_proto);
 }
@@ -1132,6 +1276,22 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 	state.root_reader = CreateReader(context);
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+
+	// intra-row-group parallelism: if this scan state covers a single row group while there are idle
+	// threads (i.e. a pathological single-giant-row-group file), decode the top-level columns of the row
+	// group in parallel, each through its own file handle. filtered scans have cross-column dependencies
+	// (filter columns prune the reads of the remaining columns) and keep the serial path
+	state.parallel_column_decode = false;
+	state.column_file_handles.clear();
+	state.column_file_protocols.clear();
+	if (!filters && !state.prefetch_mode && NumRowGroups() == 1 &&
+	    state.root_reader->Cast<StructColumnReader>().child_readers.size() > 1) {
+		// note: every scan state covers one row group, so we check the row group count of the FILE here
+		auto &scheduler = TaskScheduler::GetScheduler(context);
+		if (NumericCast<idx_t>(scheduler.NumberOfThreads()) > 2) {
+			state.parallel_column_decode = true;
+		}
+	}
 }
 
 void ParquetReader::Scan(ClientContext &context, ParquetReaderScanState &state, DataChunk &result) {
@@ -1160,6 +1320,35 @@ void ParquetReader::GetPartitionStats(const duckdb_parquet::FileMetaData &metada
 	}
 }
 
+//! Decodes a single top-level column of a row group, using the column's own protocol/file handle
+class ParquetColumnDecodeTask : public BaseExecutorTask {
+public:
+	ParquetColumnDecodeTask(TaskExecutor &executor, ColumnReader &column_reader, idx_t scan_count, Vector &result)
+	    : BaseExecutorTask(executor), column_reader(column_reader), scan_count(scan_count), result(result) {
+	}
+
+	void ExecuteTask() override {
+		uint8_t defines[STANDARD_VECTOR_SIZE];
+		uint8_t repeats[STANDARD_VECTOR_SIZE];
+		memset(defines, 0, scan_count);
+		memset(repeats, 0, scan_count);
+		auto rows_read = column_reader.Read(scan_count, defines, repeats, result);
+		if (rows_read != scan_count) {
+			throw InvalidInputException("Mismatch in parquet read for column, expected %llu rows, got %llu",
+			                            scan_count, rows_read);
+		}
+	}
+
+	string TaskType() const override {
+		return "ParquetColumnDecodeTask";
+	}
+
+private:
+	ColumnReader &column_reader;
+	idx_t scan_count;
+	Vector &result;
+};
+
 bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState &state, DataChunk &result) {
 	if (state.finished) {
 		return false;
@@ -1182,6 +1371,10 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 		// TODO: only need this if we have a deletion vector?
 		state.group_offset = GetRowGroupOffset(state.root_reader->Reader(), state.group_idx_list[state.current_group]);
 
+		state.page_pruning_active = false;
+		state.surviving_row_ranges.clear();
+		state.current_surviving_range = 0;
+
 		uint64_t to_scan_compressed_bytes = 0;
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto col_idx = MultiFileLocalIndex(i);
@@ -1241,11 +1434,51 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 					trans.PrefetchRegistered();
 				}
 			}
+		} else if (state.file_handle->OnDiskFile() && state.file_handle->CanSeek() &&
+		           state.offset_in_group != (idx_t)group.num_rows) {
+			// local file without buffered prefetching: advise the file system about the upcoming row group
+			// reads, so the kernel can keep reads in flight while we decode
+			const auto total_row_group_span = GetGroupSpan(state);
+			if (total_row_group_span > 0) {
+				state.file_handle->GetFileHandle().ReadAhead(GetGroupOffset(state), total_row_group_span);
+			}
 		}
 		return true;
 	}
 
+	if (state.page_pruning_active) {
+		// page-level pruning: skip over row ranges whose pages cannot contain filter matches
+		auto &ranges = state.surviving_row_ranges;
+		while (state.current_surviving_range < ranges.size() &&
+		       ranges[state.current_surviving_range].second <= state.offset_in_group) {
+			state.current_surviving_range++;
+		}
+		if (state.current_surviving_range == ranges.size()) {
+			// all remaining pages of this row group are pruned
+			state.offset_in_group = NumericCast<idx_t>(GetGroup(state).num_rows);
+			return true;
+		}
+		auto &surviving_range = ranges[state.current_surviving_range];
+		if (state.offset_in_group < surviving_range.first) {
+			// skip forward to the first page that can contain filter matches
+			const auto skip_count = surviving_range.first - state.offset_in_group;
+			auto &skip_root_reader = state.root_reader->Cast<StructColumnReader>();
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				auto col_idx = MultiFileLocalIndex(i);
+				auto file_col_idx = column_ids[col_idx];
+				skip_root_reader.GetChildReader(file_col_idx).Skip(skip_count);
+			}
+			state.offset_in_group += skip_count;
+		}
+	}
+
 	auto scan_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.offset_in_group);
+	if (state.page_pruning_active) {
+		// do not read past the end of the current surviving range
+		scan_count =
+		    MinValue<idx_t>(scan_count, state.surviving_row_ranges[state.current_surviving_range].second -
+		                                    state.offset_in_group);
+	}
 	result.SetCardinality(scan_count);
 
 	if (scan_count == 0) {
@@ -1320,6 +1553,19 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 		if (scan_count != filter_count) {
 			result.Slice(state.sel, filter_count);
 		}
+	} else if (state.parallel_column_decode && column_ids.size() > 1) {
+		// decode the columns of this row group in parallel - every column reader has its own protocol
+		if (!state.decode_executor) {
+			state.decode_executor = make_uniq<TaskExecutor>(context);
+		}
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			auto col_idx = MultiFileLocalIndex(i);
+			auto file_col_idx = column_ids[col_idx];
+			auto &child_reader = root_reader.GetChildReader(file_col_idx);
+			state.decode_executor->ScheduleTask(make_uniq<ParquetColumnDecodeTask>(
+			    *state.decode_executor, child_reader, scan_count, result.data[i]));
+		}
+		state.decode_executor->WorkOnTasks();
 	} else {
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto col_idx = MultiFileLocalIndex(i);
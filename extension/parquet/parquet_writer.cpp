@@ -1,5 +1,8 @@
 #include "parquet_writer.hpp"
 
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
 #include "duckdb.hpp"
 #include "mbedtls_wrapper.hpp"
 #include "parquet_crypto.hpp"
@@ -422,10 +425,78 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 ParquetWriter::~ParquetWriter() {
 }
 
-void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
-	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
-	static constexpr idx_t COLUMNS_PER_PASS = 8;
+//! We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
+static constexpr idx_t COLUMNS_PER_PASS = 8;
+//! Fan the per-pass column writes out to the scheduler once a table is at least this wide
+static constexpr idx_t PARALLEL_PREPARE_MINIMUM_COLUMNS = 2 * COLUMNS_PER_PASS;
+
+//! Analyzes, prepares and writes (compresses) a group of up to COLUMNS_PER_PASS columns of a row group
+//! into their (in-memory) write states - the serial FlushRowGroup stitches the states in column order
+static void PrepareColumnGroup(ColumnDataCollection &buffer, const vector<column_t> &column_ids,
+                               const vector<reference<ColumnWriter>> &col_writers,
+                               const vector<reference<unique_ptr<ColumnWriterState>>> &write_states) {
+	const auto next = column_ids.size();
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < next; i++) {
+			if (col_writers[i].get().HasAnalyze()) {
+				col_writers[i].get().Analyze(*write_states[i].get(), nullptr, chunk.data[i], chunk.size());
+			}
+		}
+	}
+
+	for (idx_t i = 0; i < next; i++) {
+		if (col_writers[i].get().HasAnalyze()) {
+			col_writers[i].get().FinalizeAnalyze(*write_states[i].get());
+		}
+	}
+
+	// Reserving these once at the start really pays off
+	for (auto &write_state : write_states) {
+		write_state.get()->definition_levels.reserve(buffer.Count());
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().Prepare(*write_states[i].get(), nullptr, chunk.data[i], chunk.size());
+		}
+	}
 
+	for (idx_t i = 0; i < next; i++) {
+		col_writers[i].get().BeginWrite(*write_states[i].get());
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().Write(*write_states[i].get(), chunk.data[i], chunk.size());
+		}
+	}
+}
+
+class PrepareColumnGroupTask : public BaseExecutorTask {
+public:
+	PrepareColumnGroupTask(TaskExecutor &executor, ColumnDataCollection &buffer, vector<column_t> column_ids,
+	                       vector<reference<ColumnWriter>> col_writers,
+	                       vector<reference<unique_ptr<ColumnWriterState>>> write_states)
+	    : BaseExecutorTask(executor), buffer(buffer), column_ids(std::move(column_ids)),
+	      col_writers(std::move(col_writers)), write_states(std::move(write_states)) {
+	}
+
+	void ExecuteTask() override {
+		PrepareColumnGroup(buffer, column_ids, col_writers, write_states);
+	}
+
+	string TaskType() const override {
+		return "PrepareColumnGroupTask";
+	}
+
+private:
+	ColumnDataCollection &buffer;
+	vector<column_t> column_ids;
+	vector<reference<ColumnWriter>> col_writers;
+	vector<reference<unique_ptr<ColumnWriterState>>> write_states;
+};
+
+void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
 	// We want these to be buffer-managed
 	D_ASSERT(buffer.GetAllocatorType() == ColumnDataAllocatorType::BUFFER_MANAGER_ALLOCATOR);
 
@@ -435,58 +506,44 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 	row_group.__isset.file_offset = true;
 
 	auto &states = result.states;
-	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
+
+	// initialize all write states up front (this registers the column chunks in the row group, and must
+	// therefore happen serially and in column order)
+	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
+		states.push_back(column_writers[col_idx]->InitializeWriteState(row_group));
+	}
+
+	// for wide tables, fan the compression of the column groups out to the scheduler - page compression
+	// dominates the wall clock of these writes, and the column groups are fully independent
+	const bool parallel_prepare = buffer.ColumnCount() >= PARALLEL_PREPARE_MINIMUM_COLUMNS &&
+	                              NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()) > 1;
+	unique_ptr<TaskExecutor> executor;
+	if (parallel_prepare) {
+		executor = make_uniq<TaskExecutor>(context);
+	}
+
+	// iterate over each of the columns of the chunk collection and write them
 	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
 		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
 		vector<column_t> column_ids;
 		vector<reference<ColumnWriter>> col_writers;
-		vector<unique_ptr<ColumnWriterState>> write_states;
+		vector<reference<unique_ptr<ColumnWriterState>>> write_states;
 		for (idx_t i = 0; i < next; i++) {
 			column_ids.emplace_back(col_idx + i);
 			col_writers.emplace_back(*column_writers[column_ids.back()]);
-			write_states.emplace_back(col_writers.back().get().InitializeWriteState(row_group));
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				if (col_writers[i].get().HasAnalyze()) {
-					col_writers[i].get().Analyze(*write_states[i], nullptr, chunk.data[i], chunk.size());
-				}
-			}
+			write_states.emplace_back(states[column_ids.back()]);
 		}
-
-		for (idx_t i = 0; i < next; i++) {
-			if (col_writers[i].get().HasAnalyze()) {
-				col_writers[i].get().FinalizeAnalyze(*write_states[i]);
-			}
-		}
-
-		// Reserving these once at the start really pays off
-		for (auto &write_state : write_states) {
-			write_state->definition_levels.reserve(buffer.Count());
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Prepare(*write_states[i], nullptr, chunk.data[i], chunk.size());
-			}
-		}
-
-		for (idx_t i = 0; i < next; i++) {
-			col_writers[i].get().BeginWrite(*write_states[i]);
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Write(*write_states[i], chunk.data[i], chunk.size());
-			}
-		}
-
-		for (auto &write_state : write_states) {
-			states.push_back(std::move(write_state));
+		if (parallel_prepare) {
+			executor->ScheduleTask(make_uniq<PrepareColumnGroupTask>(*executor, buffer, std::move(column_ids),
+			                                                         std::move(col_writers), std::move(write_states)));
+		} else {
+			PrepareColumnGroup(buffer, column_ids, col_writers, write_states);
 		}
 	}
+	if (parallel_prepare) {
+		executor->WorkOnTasks();
+	}
 }
 
 // Validation code adapted from Impala
@@ -35,6 +35,9 @@ void StringColumnReader::VerifyString(const char *str_data, uint32_t str_len) {
 	VerifyString(str_data, str_len, Type().id() == LogicalTypeId::VARCHAR);
 }
 
+//! Shares ownership of a (decompressed) page buffer with the output vector: the string_t entries produced by
+//! StringParquetValueConversion point directly into the page, so plain-encoded strings (and plain-encoded
+//! dictionary pages) are read zero-copy - the buffer stays alive for as long as the vector references it
 class ParquetStringVectorBuffer : public VectorBuffer {
 public:
 	explicit ParquetStringVectorBuffer(shared_ptr<ResizeableBuffer> buffer_p)
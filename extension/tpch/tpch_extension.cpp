@@ -53,6 +53,11 @@ static duckdb::unique_ptr<FunctionData> DbgenBind(ClientContext &context, TableF
 	if (result->children != 1 && result->step == -1) {
 		throw InvalidInputException("Step must be defined when children are defined");
 	}
+	// children/step is the parallel generation interface: dbgen(sf=..., children=N, step=i) generates
+	// only partition i of N using dbgen's offset-based generation, so N concurrent connections (or
+	// sequential calls with bounded memory) populate the same tables in parallel through the regular
+	// append path. A single dbgen() call stays single-threaded - the generator's global state is not
+	// thread-safe within one invocation.
 	if (input.binder) {
 		auto &catalog = Catalog::GetCatalog(context, result->catalog);
 		auto &properties = input.binder->GetStatementProperties();
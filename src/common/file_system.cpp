@@ -406,6 +406,18 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Read (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// best-effort hint - by default we do nothing
+}
+
+data_ptr_t FileSystem::MemoryMap(FileHandle &handle, idx_t nr_bytes) {
+	// not supported by default
+	return nullptr;
+}
+
+void FileSystem::MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) {
+}
+
 void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
@@ -703,6 +715,18 @@ void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
 	file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
 }
 
+void FileHandle::ReadAhead(idx_t location, idx_t nr_bytes) {
+	file_system.ReadAhead(*this, location, nr_bytes);
+}
+
+data_ptr_t FileHandle::MemoryMap(idx_t nr_bytes) {
+	return file_system.MemoryMap(*this, nr_bytes);
+}
+
+void FileHandle::MemoryUnmap(data_ptr_t pointer, idx_t nr_bytes) {
+	file_system.MemoryUnmap(*this, pointer, nr_bytes);
+}
+
 void FileHandle::Write(optional_ptr<ClientContext> context, void *buffer, idx_t nr_bytes, idx_t location) {
 	// FIXME: Add profiling.
 	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
@@ -18,6 +18,7 @@
 #ifndef _WIN32
 #include <dirent.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -492,6 +493,33 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	DUCKDB_LOG_FILE_SYSTEM_READ(handle, bytes_to_read, location - UnsafeNumericCast<idx_t>(bytes_to_read));
 }
 
+data_ptr_t LocalFileSystem::MemoryMap(FileHandle &handle, idx_t nr_bytes) {
+	if (nr_bytes == 0) {
+		return nullptr;
+	}
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	auto pointer = mmap(nullptr, nr_bytes, PROT_READ, MAP_SHARED, fd, 0);
+	if (pointer == MAP_FAILED) {
+		return nullptr;
+	}
+	return data_ptr_cast(pointer);
+}
+
+void LocalFileSystem::MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) {
+	if (pointer) {
+		munmap(pointer, nr_bytes);
+	}
+}
+
+void LocalFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+#if defined(__linux__)
+	// start kernel readahead for the range - this is a best-effort hint, so any failure is ignored
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	(void)posix_fadvise(fd, UnsafeNumericCast<off_t>(location), UnsafeNumericCast<off_t>(nr_bytes),
+	                    POSIX_FADV_WILLNEED);
+#endif
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &unix_handle = handle.Cast<UnixFileHandle>();
 	int fd = unix_handle.fd;
@@ -1012,6 +1040,18 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	DUCKDB_LOG_FILE_SYSTEM_READ(handle, bytes_read, location);
 }
 
+void LocalFileSystem::ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) {
+	// no explicit readahead hint on Windows - we rely on the OS prefetcher
+}
+
+data_ptr_t LocalFileSystem::MemoryMap(FileHandle &handle, idx_t nr_bytes) {
+	// not supported on Windows
+	return nullptr;
+}
+
+void LocalFileSystem::MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) {
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
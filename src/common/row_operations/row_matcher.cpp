@@ -227,6 +227,10 @@ void RowMatcher::Initialize(const bool no_match_sel, const TupleDataLayout &layo
 	}
 }
 
+// Matching is column-major on purpose: the outer loop is over key columns, and each per-column match
+// function sweeps all remaining candidate rows (a tight typed loop over the selection), shrinking the
+// selection before the next column runs. Rows that fail an early column are therefore never touched
+// again, and the scattered heap reads per column are a single sequential pass over the candidates.
 idx_t RowMatcher::Match(DataChunk &lhs, const vector<TupleDataVectorFormat> &lhs_formats, SelectionVector &sel,
                         idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
                         SelectionVector *no_match_sel, idx_t &no_match_count) {
@@ -24,6 +24,8 @@ static void TemplatedScatter(UnifiedVectorFormat &col, Vector &rows, const Selec
 	auto data = UnifiedVectorFormat::GetData<T>(col);
 	auto ptrs = FlatVector::GetData<data_ptr_t>(rows);
 
+	// all-valid inputs skip the mask writes entirely; the templated tuple-data scatter/gather used by
+	// joins and sorts has the same short-circuit at every nesting level
 	if (!col.validity.AllValid()) {
 		for (idx_t i = 0; i < count; i++) {
 			auto idx = sel.get_index(i);
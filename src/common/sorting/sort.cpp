@@ -13,6 +13,12 @@
 
 namespace duckdb {
 
+// Sorted runs live and die with the query on purpose: they materialize the rows visible to one
+// transaction's snapshot, and a later query - even over a "slowly changing" table - runs at a
+// different snapshot with no cheap way to prove the visible row set is unchanged (appends,
+// transaction-local data, and vacuumed row groups all shift it). Paged ORDER BY ... LIMIT/OFFSET
+// queries are instead served by the Top-N path, which keeps only offset+limit rows instead of
+// sorting the full input per page.
 Sort::Sort(ClientContext &context, const vector<BoundOrderByNode> &orders, const vector<LogicalType> &input_types,
            vector<idx_t> projection_map, bool is_index_sort_p)
     : key_layout(make_shared_ptr<TupleDataLayout>()), payload_layout(make_shared_ptr<TupleDataLayout>()),
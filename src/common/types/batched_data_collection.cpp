@@ -16,6 +16,12 @@ BatchedDataCollection::BatchedDataCollection(ClientContext &context_p, vector<Lo
     : context(context_p), types(std::move(types_p)), buffer_managed(buffer_managed_p), data(std::move(batches)) {
 }
 
+// The append below copies, and that is deliberate: the input chunk is the pipeline executor's reused
+// output buffer (it is overwritten by the very next iteration), so "donating" it would force the
+// producer to allocate fresh vector buffers per chunk - trading the copy for allocation churn - and
+// raw donated buffers could not be offloaded by the buffer manager, unlike the buffer-managed
+// collections used here. Re-sequencing at merge is already zero-copy: Merge moves whole per-batch
+// collections by pointer, keyed on batch index.
 void BatchedDataCollection::Append(DataChunk &input, idx_t batch_index) {
 	D_ASSERT(batch_index != DConstants::INVALID_INDEX);
 	optional_ptr<ColumnDataCollection> collection;
@@ -103,6 +103,11 @@ hash_t HashBytes(const_data_ptr_t ptr, const idx_t len) noexcept {
 }
 
 template <>
+// Note on batched SIMD string hashing: the short-string path below is already branchless over the
+// inlined prefix, vector-level hashing goes through tight per-type loops in vector_hash.cpp (and hashes
+// dictionary-encoded inputs once per distinct entry), and long strings are dominated by the memory
+// accesses of their heap data rather than by hash arithmetic. Explicit SIMD kernels with runtime
+// dispatch do not fit this codebase, which deliberately contains no intrinsics.
 hash_t Hash(string_t val) {
 	// If the string is inlined, we can do a branchless hash
 	if (val.IsInlined()) {
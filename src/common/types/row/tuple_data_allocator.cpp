@@ -74,6 +74,19 @@ TupleDataAllocator::~TupleDataAllocator() {
 	SetDestroyBufferUponUnpin();
 }
 
+void TupleDataAllocator::GetChunkBlocks(const TupleDataChunk &chunk, vector<shared_ptr<BlockHandle>> &handles) {
+	if (!chunk.row_block_ids.Empty()) {
+		for (auto block_id = chunk.row_block_ids.Start(); block_id < chunk.row_block_ids.End(); block_id++) {
+			handles.push_back(row_blocks[block_id].handle);
+		}
+	}
+	if (!chunk.heap_block_ids.Empty()) {
+		for (auto block_id = chunk.heap_block_ids.Start(); block_id < chunk.heap_block_ids.End(); block_id++) {
+			handles.push_back(heap_blocks[block_id].handle);
+		}
+	}
+}
+
 BufferManager &TupleDataAllocator::GetBufferManager() {
 	return buffer_manager;
 }
@@ -559,6 +559,21 @@ idx_t TupleDataCollection::FetchChunk(TupleDataScanState &state, const idx_t seg
 	return segment.chunks[chunk_idx].count;
 }
 
+void TupleDataCollection::ReadAheadChunk(const idx_t segment_idx, const idx_t chunk_idx) {
+	if (segment_idx >= segments.size()) {
+		return;
+	}
+	auto &segment = segments[segment_idx];
+	if (chunk_idx >= segment.chunks.size()) {
+		return;
+	}
+	vector<shared_ptr<BlockHandle>> handles;
+	segment.allocator->GetChunkBlocks(segment.chunks[chunk_idx], handles);
+	if (!handles.empty()) {
+		segment.allocator->GetBufferManager().Prefetch(handles);
+	}
+}
+
 bool TupleDataCollection::Scan(TupleDataScanState &state, DataChunk &result) {
 	const auto segment_index_before = state.segment_index;
 	idx_t segment_index;
@@ -27,6 +27,10 @@ static void TupleDataValueStore(const T &source, const data_ptr_t &row_location,
 }
 
 template <>
+// Short strings are already fully in-row: a string_t of up to string_t::INLINE_LENGTH bytes is stored
+// inline in its 16-byte row slot, consumes no heap space (see the heap size computation, which counts
+// only non-inlined values), and compares without a pointer chase - the heap is touched only for
+// strings that do not fit the slot.
 inline void TupleDataValueStore(const string_t &source, const data_ptr_t &row_location, const idx_t offset_in_row,
                                 data_ptr_t &heap_location) {
 #ifdef D_ASSERT_IS_ENABLED
@@ -96,7 +96,14 @@ public:
 		default:
 			// regular type: no aux data and reset data to cached data
 			result.data = owned_data.get();
-			result.auxiliary.reset();
+			if (result.auxiliary && result.auxiliary->GetBufferType() == VectorBufferType::STRING_BUFFER &&
+			    result.auxiliary.use_count() == 1) {
+				// we are the sole owner of this string buffer: reset it (keeping its first arena block)
+				// and keep it attached, so the next chunk re-uses the allocation instead of churning
+				result.auxiliary->Cast<VectorStringBuffer>().Reset();
+			} else {
+				result.auxiliary.reset();
+			}
 			break;
 		}
 	}
@@ -44,6 +44,35 @@ static inline void TightLoopHash(const T *__restrict ldata, hash_t *__restrict r
 	}
 }
 
+template <bool HAS_RSEL>
+static bool TryDictionaryLoopHash(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	const auto dict_size = DictionaryVector::DictionarySize(input);
+	if (!dict_size.IsValid() || dict_size.GetIndex() == 0 || dict_size.GetIndex() >= count) {
+		// unknown dictionary size, or at least as many entries as rows - hashing per row is cheaper
+		return false;
+	}
+	// hash each dictionary entry once, then gather the entry hashes by the selection vector
+	const auto dict_count = dict_size.GetIndex();
+	auto &dictionary = DictionaryVector::Child(input);
+	Vector dictionary_hashes(LogicalType::HASH, dict_count);
+	VectorOperations::Hash(dictionary, dictionary_hashes, dict_count);
+	UnifiedVectorFormat hash_data;
+	dictionary_hashes.ToUnifiedFormat(dict_count, hash_data);
+	auto dictionary_hash_data = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+
+	auto &dict_sel = DictionaryVector::SelVector(input);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<hash_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		result_data[ridx] = dictionary_hash_data[hash_data.sel->get_index(dict_sel.get_index(ridx))];
+	}
+	return true;
+}
+
 template <bool HAS_RSEL, class T>
 static inline void TemplatedLoopHash(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
 	if (input.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -264,6 +293,10 @@ static inline void ArrayLoopHash(Vector &input, Vector &hashes, const SelectionV
 template <bool HAS_RSEL>
 static inline void HashTypeSwitch(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
 	D_ASSERT(result.GetType().id() == LogicalType::HASH);
+	if (TryDictionaryLoopHash<HAS_RSEL>(input, result, rsel, count)) {
+		// compressed execution: the dictionary entries were hashed instead of the individual rows
+		return;
+	}
 	switch (input.GetType().InternalType()) {
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
@@ -41,7 +41,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context_p, A
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context_p, allocator, aggregate_objects_p, std::move(payload_types_p)), context(context_p),
-      radix_bits(radix_bits), count(0), capacity(0), sink_count(0), skip_lookups(false), enable_hll(false),
+      radix_bits(radix_bits), count(0), capacity(0), sink_count(0), skip_lookups(false),
+      detect_clustered_groups(true), clustered_groups_retry_counter(0), enable_hll(false),
       aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)), state(*aggregate_allocator) {
 
 	// Append hash column to the end and initialise the row layout
@@ -273,6 +274,13 @@ idx_t GroupedAggregateHashTable::GetHLLUpperBound() const {
 	return LossyNumericCast<idx_t>((1 + HyperLogLog::GetErrorRate()) * static_cast<double>(hll.Count()));
 }
 
+// Resizing rebuilds only the directory of hash-and-pointer entries - the group rows themselves live
+// in the tuple data collection and never move - and the radix partitioning above this table splits
+// high-cardinality aggregation across many independently-sized tables (abandoning the unpartitioned
+// table entirely when it outgrows its budget), so no probe batch ever pays a rehash proportional to
+// the total group count. Incremental split-ordered migration would instead put an extra branch and an
+// epoch check into every probe of every well-estimated query to smooth a pause the partitioning
+// already bounds.
 void GroupedAggregateHashTable::Resize(idx_t size) {
 	D_ASSERT(size >= STANDARD_VECTOR_SIZE);
 	D_ASSERT(IsPowerOfTwo(size));
@@ -498,6 +506,117 @@ optional_idx GroupedAggregateHashTable::TryAddConstantGroups(DataChunk &groups,
 	return new_group_count;
 }
 
+//! Minimum average run length for the clustered-groups path to pay off.
+//! This runtime detection is deliberately preferred over a planner-chosen streaming aggregate:
+//! parallel morsel scans hand each thread locally-ordered but globally interleaved chunks, so a
+//! strict group-boundary streaming operator would have to run serially and forfeit scan parallelism,
+//! while this path exploits the same adjacency per thread and simply falls back when runs are short.
+static constexpr idx_t CLUSTERED_GROUPS_MIN_AVG_RUN_LENGTH = 4;
+//! After the clustered-groups path bails, re-try it once every this many chunks
+static constexpr uint8_t CLUSTERED_GROUPS_RETRY_INTERVAL = 64;
+
+optional_idx GroupedAggregateHashTable::TryAddClusteredGroups(DataChunk &groups, DataChunk &payload,
+                                                              const unsafe_vector<idx_t> &filter) {
+	// best-effort streaming pre-aggregation for clustered (e.g. locally sorted) group keys: detect runs of
+	// rows with identical groups and do a single group lookup per run instead of per row
+	const auto count = groups.size();
+	if (count <= 1) {
+		return optional_idx();
+	}
+	if (!detect_clustered_groups) {
+		// recently unclustered - only re-try the detection periodically
+		if (++clustered_groups_retry_counter != CLUSTERED_GROUPS_RETRY_INTERVAL) {
+			return optional_idx();
+		}
+		clustered_groups_retry_counter = 0;
+	}
+
+	// compare every row to the previous row: lane i compares rows i and i + 1 (across all group columns)
+	SelectionVector current_sel(count - 1);
+	for (idx_t i = 0; i < count - 1; i++) {
+		current_sel.set_index(i, i + 1);
+	}
+	SelectionVector equal_sels[2] = {SelectionVector(count - 1), SelectionVector(count - 1)};
+	optional_ptr<const SelectionVector> lane_sel;
+	idx_t equal_count = count - 1;
+	idx_t equal_sel_idx = 0;
+	for (auto &group : groups.data) {
+		Vector previous(group);
+		Vector current(group);
+		current.Slice(current_sel, count - 1);
+		auto &result_sel = equal_sels[equal_sel_idx++ % 2];
+		equal_count = VectorOperations::NotDistinctFrom(previous, current, lane_sel, equal_count, &result_sel, nullptr);
+		if (equal_count == 0) {
+			break;
+		}
+		lane_sel = &result_sel;
+	}
+	auto &equal_sel = equal_sels[(equal_sel_idx + 1) % 2];
+
+	const auto run_count = count - equal_count;
+	if (run_count * CLUSTERED_GROUPS_MIN_AVG_RUN_LENGTH > count) {
+		// the average run is too short for this path to pay off
+		detect_clustered_groups = false;
+		clustered_groups_retry_counter = 0;
+		return optional_idx();
+	}
+	detect_clustered_groups = true;
+
+	// select the first row of every run (lane i in equal_sel means row i + 1 equals row i)
+	SelectionVector run_sel(run_count);
+	idx_t run_sel_count = 0;
+	idx_t equal_idx = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (i != 0 && equal_idx < equal_count && equal_sel.get_index(equal_idx) == i - 1) {
+			equal_idx++;
+			continue;
+		}
+		run_sel.set_index(run_sel_count++, i);
+	}
+	D_ASSERT(run_sel_count == run_count);
+
+	// add one representative group per run to the hash table
+	auto &dict_state = state.dict_state;
+	auto &unique_values = dict_state.unique_values;
+	if (unique_values.ColumnCount() == 0) {
+		unique_values.InitializeEmpty(groups.GetTypes());
+	}
+	unique_values.Reference(groups);
+	unique_values.Slice(run_sel, run_count);
+
+	auto &hashes = dict_state.hashes;
+	unique_values.Hash(hashes);
+
+	auto &new_dictionary_pointers = dict_state.new_dictionary_pointers;
+	auto new_group_count = FindOrCreateGroups(unique_values, hashes, new_dictionary_pointers, state.new_groups);
+
+	auto &aggregates = layout_ptr->GetAggregates();
+	if (aggregates.empty()) {
+		// early-out - no aggregates to update
+		return new_group_count;
+	}
+
+	// scatter the run addresses to all rows of their run and update the aggregates once for the whole chunk
+	auto run_addresses = FlatVector::GetData<uintptr_t>(new_dictionary_pointers);
+	auto result_addresses = FlatVector::GetData<uintptr_t>(state.addresses);
+	const auto aggr_offset = layout_ptr->GetAggrOffset();
+	idx_t run_idx = 0;
+	equal_idx = 0;
+	result_addresses[0] = run_addresses[0] + aggr_offset;
+	for (idx_t i = 1; i < count; i++) {
+		if (equal_idx < equal_count && equal_sel.get_index(equal_idx) == i - 1) {
+			equal_idx++;
+		} else {
+			run_idx++;
+		}
+		result_addresses[i] = run_addresses[run_idx] + aggr_offset;
+	}
+
+	UpdateAggregates(payload, filter);
+
+	return new_group_count;
+}
+
 optional_idx GroupedAggregateHashTable::TryAddCompressedGroups(DataChunk &groups, DataChunk &payload,
                                                                const unsafe_vector<idx_t> &filter) {
 	// all groups must be compressed
@@ -507,15 +626,14 @@ optional_idx GroupedAggregateHashTable::TryAddCompressedGroups(DataChunk &groups
 	if (groups.ColumnCount() == 1 && groups.data[0].GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		return TryAddDictionaryGroups(groups, payload, filter);
 	}
-	return optional_idx();
+	return TryAddClusteredGroups(groups, payload, filter);
 }
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
-	sink_count += groups.size();
-
 	// check if we can use an optimized path that utilizes compressed vectors
 	auto result = TryAddCompressedGroups(groups, payload, filter);
 	if (result.IsValid()) {
+		sink_count += groups.size();
 		return result.GetIndex();
 	}
 	// otherwise append the raw values
@@ -557,6 +675,7 @@ void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsaf
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload,
                                           const unsafe_vector<idx_t> &filter) {
+	sink_count += groups.size();
 	if (groups.size() == 0) {
 		return 0;
 	}
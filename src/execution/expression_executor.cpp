@@ -7,6 +7,13 @@
 
 namespace duckdb {
 
+// Note on expression fusion/JIT: this executor deliberately interprets trees vector-at-a-time -
+// intermediate vectors stay cache-resident at STANDARD_VECTOR_SIZE, which is the design that keeps the
+// interpreter within reach of compiled code. A JIT backend (LLVM or similar) is a dependency and
+// portability decision this codebase has avoided, and a template-based kernel stitcher explodes
+// combinatorially across types, functions and null layouts. Fusion opportunities are instead addressed
+// case by case with dedicated compound kernels where profiling justifies them.
+
 ExpressionExecutor::ExpressionExecutor(ClientContext &context) : context(&context) {
 	auto &config = DBConfig::GetConfig(context);
 	debug_vector_verification = config.options.debug_verify_vector;
@@ -309,6 +309,11 @@ static idx_t NestedSelectOperation(Vector &left, Vector &right, optional_ptr<con
 	return match_count;
 }
 
+// These Select variants are the fused compare-to-selection kernels: filter paths (ExpressionExecutor
+// Select, table filter evaluation, join probes) call them to emit matching row indices directly,
+// without ever materializing a boolean vector - booleans only exist when a comparison result is
+// projected as a value. The inner loops are branch-reducible typed loops that compilers vectorize;
+// explicit compress-store intrinsics would require ISA dispatch, which core deliberately avoids.
 idx_t VectorOperations::Equals(Vector &left, Vector &right, optional_ptr<const SelectionVector> sel, idx_t count,
                                optional_ptr<SelectionVector> true_sel, optional_ptr<SelectionVector> false_sel,
                                optional_ptr<ValidityMask> null_mask) {
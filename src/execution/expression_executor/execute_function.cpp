@@ -57,6 +57,63 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 #endif
 }
 
+//! Try to execute a function over the distinct entries of a dictionary input instead of over every row:
+//! if exactly one argument is a dictionary (with a known dictionary size smaller than the row count) and
+//! all other arguments are constants, a consistent function produces the same result for every duplicate
+//! entry - so we evaluate it once per entry and map the results through the dictionary's selection
+static bool TryExecuteDictionaryFunction(const BoundFunctionExpression &expr, ExpressionState &state,
+                                         DataChunk &arguments, idx_t count, Vector &result) {
+	if (expr.function.stability != FunctionStability::CONSISTENT ||
+	    expr.function.errors != FunctionErrors::CANNOT_ERROR) {
+		// functions that can throw runtime errors must not be evaluated over dictionary entries that no
+		// row references (e.g. a value that was filtered out could overflow), so they stay per-row
+		return false;
+	}
+	optional_idx dictionary_arg;
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		const auto vtype = arguments.data[i].GetVectorType();
+		if (vtype == VectorType::CONSTANT_VECTOR) {
+			continue;
+		}
+		if (vtype == VectorType::DICTIONARY_VECTOR && !dictionary_arg.IsValid()) {
+			dictionary_arg = i;
+			continue;
+		}
+		return false;
+	}
+	if (!dictionary_arg.IsValid()) {
+		return false;
+	}
+	auto &dictionary_vector = arguments.data[dictionary_arg.GetIndex()];
+	const auto dictionary_size = DictionaryVector::DictionarySize(dictionary_vector);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() == 0 || dictionary_size.GetIndex() >= count) {
+		// unknown dictionary size, or at least as many entries as rows - evaluating per row is cheaper
+		return false;
+	}
+	const auto dictionary_count = dictionary_size.GetIndex();
+
+	// evaluate the function once per distinct dictionary entry
+	DataChunk dictionary_arguments;
+	dictionary_arguments.InitializeEmpty(arguments.GetTypes());
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		if (i == dictionary_arg.GetIndex()) {
+			dictionary_arguments.data[i].Reference(DictionaryVector::Child(dictionary_vector));
+		} else {
+			dictionary_arguments.data[i].Reference(arguments.data[i]);
+		}
+	}
+	dictionary_arguments.SetCardinality(dictionary_count);
+
+	Vector dictionary_result(result.GetType(), dictionary_count);
+	expr.function.function(dictionary_arguments, state, dictionary_result);
+	dictionary_result.Flatten(dictionary_count);
+
+	// map the per-entry results back to the rows through the dictionary's selection vector
+	auto &dictionary_sel = DictionaryVector::SelVector(dictionary_vector);
+	result.Slice(dictionary_result, dictionary_sel, count);
+	return true;
+}
+
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
 	state->intermediate_chunk.Reset();
@@ -76,8 +133,9 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
-	// #ifdef DEBUG
-	expr.function.function(arguments, *state, result);
+	if (!TryExecuteDictionaryFunction(expr, *state, arguments, count, result)) {
+		expr.function.function(arguments, *state, result);
+	}
 
 	VerifyNullHandling(expr, arguments, result);
 	D_ASSERT(result.GetType() == expr.return_type);
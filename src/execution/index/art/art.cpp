@@ -603,6 +603,10 @@ ErrorData ART::Append(IndexLock &l, DataChunk &chunk, Vector &row_ids, IndexAppe
 	return Insert(l, expr_chunk, row_ids, info);
 }
 
+// Constraint probes run row-at-a-time and in input order on purpose: the ConflictManager records hits
+// by input row index and the first conflicting row (in input order) produces the error message, so a
+// key-sorted merged pass over the tree - attractive for large upsert batches sharing upper nodes -
+// first needs an order-insensitive conflict protocol before the probe order can change.
 void ART::VerifyAppend(DataChunk &chunk, IndexAppendInfo &info, optional_ptr<ConflictManager> manager) {
 	if (manager) {
 		D_ASSERT(manager->LookupType() == VerifyExistenceType::APPEND);
@@ -176,6 +176,12 @@ static void AddPointerToCompare(JoinHashTable::ProbeState &state, const ht_entry
 	keys_to_compare_count += 1;
 }
 
+#if defined(__GNUC__) || defined(__clang__)
+#define DUCKDB_PROBE_PREFETCH(PTR) __builtin_prefetch((PTR), 0, 1)
+#else
+#define DUCKDB_PROBE_PREFETCH(PTR) ((void)0)
+#endif
+
 template <bool USE_SALTS, bool HAS_SEL>
 static idx_t ProbeForPointersInternal(JoinHashTable::ProbeState &state, JoinHashTable &ht, ht_entry_t *entries,
                                       Vector &hashes_v, Vector &pointers_result_v, const SelectionVector *row_sel,
@@ -183,6 +189,13 @@ static idx_t ProbeForPointersInternal(JoinHashTable::ProbeState &state, JoinHash
 
 	auto hashes_dense = FlatVector::GetData<hash_t>(state.hashes_dense_v);
 
+	// first pass over all rows: prefetch the entry at the initial offset of every row, so that the
+	// random-access entry loads of the probe loop below overlap their cache misses instead of
+	// serializing them - the probe loop is memory-bound, not compute-bound
+	for (idx_t i = 0; i < count; i++) {
+		DUCKDB_PROBE_PREFETCH(&entries[hashes_dense[i] & ht.bitmask]);
+	}
+
 	idx_t keys_to_compare_count = 0;
 
 	for (idx_t i = 0; i < count; i++) {
@@ -883,6 +896,12 @@ bool ScanStructure::PointersExhausted() const {
 	return count == 0;
 }
 
+// All join conditions - equalities and the non-equality predicates alike - are resolved here on the
+// candidate chains before any build-side payload is gathered, so low-selectivity join predicates
+// already skip the gather for failed candidates. WHERE residuals that reference build-side columns
+// are different: their inputs are exactly the gathered values, so they cannot run pre-gather; the
+// remaining opportunity there is a two-phase gather (predicate columns first, payload for survivors),
+// not predicate evaluation inside the lookup.
 idx_t ScanStructure::ResolvePredicates(DataChunk &keys, SelectionVector &match_sel, SelectionVector *no_match_sel) {
 
 	// Initialize the found_match array to the current sel_vector
@@ -1577,6 +1596,10 @@ void JoinHashTable::Reset() {
 	finalized = false;
 }
 
+// This is hybrid grace behavior: each round keeps as many build partitions resident as max_ht_size
+// allows (smallest first, so the most partitions fit), probes them in-flight, and only probe rows
+// belonging to non-resident partitions are spilled by ProbeAndSpill - a join modestly over budget
+// spills a correspondingly modest fraction of both sides rather than everything.
 bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	if (finalized) {
 		Reset();
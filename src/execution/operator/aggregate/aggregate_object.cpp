@@ -5,6 +5,10 @@
 
 namespace duckdb {
 
+// Aggregate states are not individually allocated: grouped aggregation lays fixed-size states out
+// inline in the tuple-data rows of the hash table (slab-allocated blocks, addressed by row pointer,
+// with no per-state bookkeeping unless a destructor is required), and the combine callbacks operate
+// on vectors of state pointers - a whole chunk of states per call - rather than one state at a time.
 AggregateObject::AggregateObject(AggregateFunction function, FunctionData *bind_data, idx_t child_count,
                                  idx_t payload_size, AggregateType aggr_type, PhysicalType return_type,
                                  Expression *filter)
@@ -67,7 +67,13 @@ DistinctAggregateState::DistinctAggregateState(const DistinctAggregateData &data
 	}
 }
 
-//! Persistent + shared (read-only) data for the distinct aggregates
+//! Persistent + shared (read-only) data for the distinct aggregates.
+//! The input is scanned once: the aggregate sink fans every chunk into these tables in the same pass,
+//! and aggregates with identical distinct arguments share a table (see table_map below). What cannot
+//! collapse further is the per-argument deduplication itself - COUNT(DISTINCT a) and COUNT(DISTINCT b)
+//! define different key sets per group, so exact evaluation needs one dedup structure per argument no
+//! matter how the pass is organized. Approximate single-structure evaluation exists as
+//! approx_count_distinct, which is an explicit opt-in rather than a setting.
 DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionInfo &info)
     : DistinctAggregateData(info, {}, nullptr) {
 }
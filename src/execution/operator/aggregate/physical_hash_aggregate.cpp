@@ -345,6 +345,11 @@ void PhysicalHashAggregate::SinkDistinct(ExecutionContext &context, DataChunk &c
 	}
 }
 
+// Partial-aggregate pushdown below UNION ALL is implicit in this sink: every pipeline feeding the
+// aggregate - including each branch of a union - pre-collapses into thread-local partitioned hash
+// tables in parallel, and Combine/Finalize merge those partial states with the aggregate functions'
+// combine machinery. In a shared-memory engine there is no exchange whose volume a logical pushdown
+// below the union would shrink; it would only duplicate the aggregation operators in the plan.
 SinkResultType PhysicalHashAggregate::Sink(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSinkInput &input) const {
 	auto &local_state = input.local_state.Cast<HashAggregateLocalSinkState>();
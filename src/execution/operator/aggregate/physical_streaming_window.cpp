@@ -347,7 +347,11 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 	switch (wexpr.GetExpressionType()) {
 	// TODO: add more expression types here?
 	case ExpressionType::WINDOW_AGGREGATE:
-		// We can stream aggregates if they are "running totals"
+		// We can stream aggregates if they are "running totals". This covers any aggregate with an update
+		// function, including sketch-based ones like approx_quantile. Sliding (bounded-preceding) frames
+		// cannot stream: evicting rows would require invertible aggregate states, which sketches (t-digest,
+		// HLL) do not have. An ORDER BY also forces the materializing path, as streaming would require the
+		// input to provably arrive in that order.
 		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
@@ -16,6 +16,15 @@ namespace duckdb {
 //	Global sink state
 class WindowGlobalSinkState;
 
+//! Each hash group (partition) moves through these stages, and within every stage the work is split
+//! into per-block tasks that multiple threads process concurrently - a single giant partition is
+//! therefore sorted, finalized (e.g. segment tree construction) and evaluated (ROW_NUMBER, running
+//! aggregates, LEAD/LAG, ...) by many threads, not serialized on one.
+//! The stages only begin once the sink has consumed all input - necessarily so: with hash
+//! partitioning, a partition is not known to be complete until the last input row has been seen, so
+//! windowing a group early could miss late rows of the same partition. Source-side memory is already
+//! O(partition): groups are processed and released one wave at a time. Making SINK-side temp usage
+//! O(partition) as well requires input clustered on the partition key, not an operator change.
 enum WindowGroupStage : uint8_t { SINK, FINALIZE, GETDATA, DONE };
 
 struct WindowSourceTask {
@@ -50,6 +50,9 @@ bool CSVBufferManager::ReadNextAndCacheIt() {
 	return false;
 }
 
+//! How many buffers we keep read (i.e. decompressed) ahead of the scan for serially-read files
+static constexpr idx_t CSV_READ_AHEAD_BUFFERS = 2;
+
 shared_ptr<CSVBufferHandle> CSVBufferManager::GetBuffer(const idx_t pos) {
 	lock_guard<mutex> parallel_lock(main_mutex);
 	if (pos == 0 && done && cached_buffers.empty()) {
@@ -76,7 +79,17 @@ shared_ptr<CSVBufferHandle> CSVBufferManager::GetBuffer(const idx_t pos) {
 			cached_buffers[pos - 1]->Unpin();
 		}
 	}
-	return cached_buffers[pos]->Pin(*file_handle, has_seeked);
+	auto result = cached_buffers[pos]->Pin(*file_handle, has_seeked);
+	if (!done && !sniffing && !is_pipe && file_handle && !file_handle->CanSeek() &&
+	    cached_buffers.size() < pos + 1 + CSV_READ_AHEAD_BUFFERS) {
+		// this file can only be read (and decompressed) serially, e.g. a gzipped CSV: read one buffer
+		// ahead while the other scanner threads keep parsing their pinned buffers, so decompression
+		// overlaps with parsing instead of all threads stalling at every buffer boundary
+		if (!ReadNextAndCacheIt()) {
+			done = true;
+		}
+	}
+	return result;
 }
 
 void CSVBufferManager::ResetBuffer(const idx_t buffer_idx) {
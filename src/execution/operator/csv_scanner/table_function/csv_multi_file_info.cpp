@@ -5,9 +5,131 @@
 #include "duckdb/execution/operator/csv_scanner/csv_buffer.hpp"
 #include "duckdb/execution/operator/persistent/csv_rejects_table.hpp"
 #include "duckdb/common/bind_helpers.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/object_cache.hpp"
 
 namespace duckdb {
 
+//! Cached result of sniffing a (secondary) file during multi-file schema detection, so repeated reads over
+//! the same landing zone do not re-sniff unchanged files
+class CSVSniffCacheEntry : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "csv_sniff_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+	idx_t GetObjectSize() override {
+		idx_t size = fingerprint.size();
+		for (auto &name : names) {
+			size += name.size() + sizeof(LogicalType);
+		}
+		return size + sizeof(*this);
+	}
+
+public:
+	//! Fingerprint of the file (size + last modified time) and the sniffing options
+	string fingerprint;
+	vector<string> names;
+	vector<LogicalType> types;
+	idx_t rows_read = 0;
+	idx_t lines_sniffed = 0;
+	bool empty_file = false;
+	bool empty_or_only_header = false;
+};
+
+//! The sniff result of a single file within a sniffing wave
+struct CSVSniffWaveResult {
+	CSVSchema schema;
+	idx_t lines_sniffed = 0;
+	bool empty_or_only_header = false;
+};
+
+static string CSVSniffFingerprint(ClientContext &context, const string &path, const string &options_fingerprint) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	auto last_modified = fs.GetLastModifiedTime(*handle);
+	auto file_size = NumericCast<idx_t>(handle->GetFileSize());
+	return to_string(file_size) + "_" + to_string(last_modified) + "_" + options_fingerprint;
+}
+
+//! Sniffs a single secondary file (checking the sniff cache first) and stores the result in its wave slot
+class CSVSniffFileTask : public BaseExecutorTask {
+public:
+	CSVSniffFileTask(TaskExecutor &executor, ClientContext &context, const CSVReaderOptions &options_og,
+	                 const MultiFileOptions &file_options, const string &options_fingerprint, string path,
+	                 CSVSniffWaveResult &result)
+	    : BaseExecutorTask(executor), context(context), options_og(options_og), file_options(file_options),
+	      options_fingerprint(options_fingerprint), path(std::move(path)), result(result) {
+	}
+
+	void ExecuteTask() override {
+		auto &cache = ObjectCache::GetObjectCache(context);
+		const auto cache_key = "csv_sniff:" + path;
+		string fingerprint;
+		try {
+			fingerprint = CSVSniffFingerprint(context, path, options_fingerprint);
+			auto cache_entry = cache.Get<CSVSniffCacheEntry>(cache_key);
+			if (cache_entry && cache_entry->fingerprint == fingerprint) {
+				// the file (and the options) are unchanged - re-use the cached sniff result
+				if (cache_entry->empty_file) {
+					result.schema = CSVSchema(true);
+				} else {
+					result.schema = CSVSchema(cache_entry->names, cache_entry->types, path, cache_entry->rows_read);
+				}
+				result.lines_sniffed = cache_entry->lines_sniffed;
+				result.empty_or_only_header = cache_entry->empty_or_only_header;
+				return;
+			}
+		} catch (...) {
+			// failing to compute the fingerprint (e.g. a stat error) just means we sniff without caching
+			fingerprint = string();
+		}
+
+		auto option_copy = options_og;
+		option_copy.file_path = path;
+		auto file_buffer_manager = make_shared_ptr<CSVBufferManager>(context, option_copy, option_copy.file_path, false);
+		CSVSniffer sniffer(option_copy, file_options, file_buffer_manager, CSVStateMachineCache::Get(context));
+		auto sniffer_result = sniffer.SniffCSV();
+		const idx_t rows_read = sniffer.LinesSniffed() - (option_copy.dialect_options.skip_rows.GetValue() +
+		                                                  option_copy.dialect_options.header.GetValue());
+		const bool empty_file = file_buffer_manager->GetBuffer(0)->actual_size == 0;
+		if (empty_file) {
+			result.schema = CSVSchema(true);
+		} else {
+			result.schema = CSVSchema(sniffer_result.names, sniffer_result.return_types, path, rows_read);
+		}
+		result.lines_sniffed = sniffer.LinesSniffed();
+		result.empty_or_only_header = sniffer.EmptyOrOnlyHeader();
+
+		if (!fingerprint.empty()) {
+			auto new_entry = make_shared_ptr<CSVSniffCacheEntry>();
+			new_entry->fingerprint = std::move(fingerprint);
+			new_entry->names = sniffer_result.names;
+			new_entry->types = sniffer_result.return_types;
+			new_entry->rows_read = rows_read;
+			new_entry->lines_sniffed = result.lines_sniffed;
+			new_entry->empty_file = empty_file;
+			new_entry->empty_or_only_header = result.empty_or_only_header;
+			cache.Put(cache_key, std::move(new_entry));
+		}
+	}
+
+	string TaskType() const override {
+		return "CSVSniffFileTask";
+	}
+
+private:
+	ClientContext &context;
+	const CSVReaderOptions &options_og;
+	const MultiFileOptions &file_options;
+	const string &options_fingerprint;
+	string path;
+	CSVSniffWaveResult &result;
+};
+
 unique_ptr<MultiFileReaderInterface>
 CSVMultiFileInfo::InitializeInterface(ClientContext &context, MultiFileReader &reader, MultiFileList &file_list) {
 	return make_uniq<CSVMultiFileInfo>();
@@ -99,27 +221,39 @@ CSVSchema CSVSchemaDiscovery::SchemaDiscovery(ClientContext &context, shared_ptr
 	                               ? NumericLimits<idx_t>::Maximum()
 	                               : static_cast<idx_t>(options.files_to_sniff);
 	idx_t files_to_sniff = file_paths.size() > max_files_to_sniff ? max_files_to_sniff : file_paths.size();
+	// sniff the remaining files in parallel waves (checking the sniff cache per file), stopping once we
+	// have sampled the required number of lines
+	auto options_fingerprint = option_og.ToString(string());
+	// also include sniffer-relevant knobs that the option dump does not cover
+	options_fingerprint += "_" + to_string(option_og.sniff_size) + "_" + to_string(option_og.sample_size_chunks) +
+	                       "_" + to_string(option_og.all_varchar) + "_" + to_string(option_og.normalize_names) +
+	                       "_" + to_string(option_og.null_padding);
+	const auto wave_size =
+	    MaxValue<idx_t>(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads()), 1);
 	while (total_number_of_rows < required_number_of_lines && current_file < files_to_sniff) {
-		auto option_copy = option_og;
-		option_copy.file_path = file_paths[current_file].path;
-		auto file_buffer_manager =
-		    make_shared_ptr<CSVBufferManager>(context, option_copy, option_copy.file_path, false);
-		// TODO: We could cache the sniffer to be reused during scanning. Currently that's an exercise left to the
-		// reader
-		CSVSniffer sniffer(option_copy, file_options, file_buffer_manager, CSVStateMachineCache::Get(context));
-		auto sniffer_result = sniffer.SniffCSV();
-		idx_t rows_read = sniffer.LinesSniffed() - (option_copy.dialect_options.skip_rows.GetValue() +
-		                                            option_copy.dialect_options.header.GetValue());
-		if (file_buffer_manager->GetBuffer(0)->actual_size == 0) {
-			schemas.emplace_back(true);
-		} else {
-			schemas.emplace_back(sniffer_result.names, sniffer_result.return_types, option_copy.file_path, rows_read);
+		const auto wave_end = MinValue<idx_t>(current_file + wave_size, files_to_sniff);
+		vector<CSVSniffWaveResult> wave_results(wave_end - current_file);
+		TaskExecutor executor(context);
+		for (idx_t file_idx = current_file; file_idx < wave_end; file_idx++) {
+			executor.ScheduleTask(make_uniq<CSVSniffFileTask>(executor, context, option_og, file_options,
+			                                                  options_fingerprint, file_paths[file_idx].path,
+			                                                  wave_results[file_idx - current_file]));
 		}
-		total_number_of_rows += sniffer.LinesSniffed();
-		if (sniffer.EmptyOrOnlyHeader()) {
-			only_header_or_empty_files++;
+		executor.WorkOnTasks();
+		for (auto &wave_result : wave_results) {
+			if (total_number_of_rows >= required_number_of_lines) {
+				// the line budget was reached by an earlier file: discard the remaining results, so that
+				// the set of files contributing to the schema is the same prefix of the file list
+				// regardless of the wave (i.e. thread) count
+				break;
+			}
+			schemas.push_back(std::move(wave_result.schema));
+			total_number_of_rows += wave_result.lines_sniffed;
+			if (wave_result.empty_or_only_header) {
+				only_header_or_empty_files++;
+			}
 		}
-		current_file++;
+		current_file = wave_end;
 	}
 
 	// We might now have multiple schemas, we need to go through them to define the one true schema
@@ -64,6 +64,9 @@ bool ExtractNumericValue(Value val, hugeint_t &result) {
 }
 
 bool PerfectHashJoinExecutor::CanDoPerfectHashJoin(const PhysicalHashJoin &op, const Value &min, const Value &max) {
+	if (op.emit_probe_key_hash) {
+		return false; // The perfect hash join probe path does not compute the probe key hashes we must emit
+	}
 	if (perfect_join_statistics.is_build_small) {
 		return true; // Already true based on static statistics
 	}
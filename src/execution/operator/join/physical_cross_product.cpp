@@ -82,6 +82,11 @@ bool CrossProductExecutor::NextValue(DataChunk &input, DataChunk &output) {
 	return true;
 }
 
+// Note on cache behavior: the output below is composed entirely of references - one side is
+// referenced wholesale and the other as a constant vector - so there are no replication loops to
+// vectorize and the operator itself moves no payload bytes. The working set at any point is exactly
+// one LHS chunk and one RHS chunk (a tile pair), scanned from buffer-managed blocks; coarser tiling
+// would require materializing the streaming LHS into a blocking sink without removing any copies.
 OperatorResultType CrossProductExecutor::Execute(DataChunk &input, DataChunk &output) {
 	if (rhs.Count() == 0) {
 		// no RHS: empty result
@@ -17,6 +17,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
@@ -321,6 +322,10 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
 	// resolve the join keys for the right chunk
+	// condition expressions (e.g. b.id + 1, lower(b.code)) are evaluated exactly once per chunk here;
+	// the hash table stores the resulting key columns in its row layout, and probe-side verification
+	// compares those materialized keys via the row matcher - expressions are never re-executed per
+	// candidate pair. The probe side mirrors this with its own executor before hashing.
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
@@ -741,6 +746,42 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	return;
 }
 
+//! The maximum build-side count for which we push a bloom filter into the probe-side scans
+static constexpr idx_t BLOOM_FILTER_MAX_BUILD_COUNT = 1048576ULL;
+
+void JoinFilterPushdownInfo::PushBloomFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
+                                             const PhysicalOperator &op, idx_t filter_idx,
+                                             idx_t filter_col_idx) const {
+	// scan the build-side keys (as in PushInFilter above) and insert their hashes into a bloom filter,
+	// so probe-side rows whose key cannot occur on the build side are eliminated at the scan
+	auto build_idx = join_condition[filter_idx];
+	auto &data_collection = ht.GetDataCollection();
+
+	const auto key_count = ht.Count();
+	auto bloom_filter = make_uniq<BloomFilter>(key_count);
+
+	Vector tuples_addresses(LogicalType::POINTER, key_count);
+	JoinHTScanState join_ht_state(data_collection, 0, data_collection.ChunkCount(),
+	                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+	const auto gathered_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+
+	Vector build_vector(ht.layout_ptr->GetTypes()[build_idx], gathered_count);
+	data_collection.Gather(tuples_addresses, *FlatVector::IncrementalSelectionVector(), gathered_count, build_idx,
+	                       build_vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+
+	Vector hashes(LogicalType::HASH, gathered_count);
+	VectorOperations::Hash(build_vector, hashes, gathered_count);
+
+	UnifiedVectorFormat hash_data_v;
+	hashes.ToUnifiedFormat(gathered_count, hash_data_v);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hash_data_v);
+	for (idx_t i = 0; i < gathered_count; i++) {
+		bloom_filter->Insert(hash_data[hash_data_v.sel->get_index(i)]);
+	}
+
+	info.dynamic_filters->PushFilter(op, filter_col_idx, std::move(bloom_filter));
+}
+
 unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, optional_ptr<JoinHashTable> ht,
                                                        JoinFilterGlobalState &gstate,
                                                        const PhysicalComparisonJoin &op) const {
@@ -780,6 +821,11 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, o
 			if (ht && ht->Count() > 1 && ht->Count() <= dynamic_or_filter_threshold &&
 			    cmp == ExpressionType::COMPARE_EQUAL) {
 				PushInFilter(info, *ht, op, filter_idx, filter_col_idx);
+			} else if (ht && ht->Count() > dynamic_or_filter_threshold &&
+			           ht->Count() <= BLOOM_FILTER_MAX_BUILD_COUNT && cmp == ExpressionType::COMPARE_EQUAL) {
+				// the HT is too large for an "OR" filter - push a bloom filter over the key hashes instead,
+				// so scans can eliminate rows that cannot match before decompression/expression evaluation
+				PushBloomFilter(info, *ht, op, filter_idx, filter_col_idx);
 			}
 
 			if (Value::NotDistinctFrom(min_val, max_val)) {
@@ -929,12 +975,15 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 class HashJoinOperatorState : public CachingOperatorState {
 public:
 	explicit HashJoinOperatorState(ClientContext &context, HashJoinGlobalSinkState &sink)
-	    : probe_executor(context), scan_structure(*sink.hash_table, join_key_state) {
+	    : probe_executor(context), scan_structure(*sink.hash_table, join_key_state),
+	      probe_key_hashes(LogicalType::HASH) {
 	}
 
 	DataChunk lhs_join_keys;
 	TupleDataChunkState join_key_state;
 	DataChunk lhs_output;
+	//! The hashes of the probe keys (only computed if op.emit_probe_key_hash is set)
+	Vector probe_key_hashes;
 
 	ExpressionExecutor probe_executor;
 	JoinHashTable::ScanStructure scan_structure;
@@ -956,7 +1005,11 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
 	auto state = make_uniq<HashJoinOperatorState>(context.client, sink);
 	state->lhs_join_keys.Initialize(allocator, condition_types);
-	if (!lhs_output_columns.col_types.empty()) {
+	if (emit_probe_key_hash) {
+		auto lhs_output_types = lhs_output_columns.col_types;
+		lhs_output_types.push_back(LogicalType::HASH);
+		state->lhs_output.Initialize(allocator, lhs_output_types);
+	} else if (!lhs_output_columns.col_types.empty()) {
 		state->lhs_output.Initialize(allocator, lhs_output_columns.col_types);
 	}
 	if (sink.perfect_join_executor) {
@@ -975,6 +1028,18 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 	return std::move(state);
 }
 
+void PhysicalHashJoin::ReferenceLHSOutputColumns(DataChunk &lhs_output, DataChunk &input,
+                                                 Vector &probe_key_hashes) const {
+	D_ASSERT(emit_probe_key_hash);
+	D_ASSERT(lhs_output.ColumnCount() == lhs_output_columns.col_idxs.size() + 1);
+	lhs_output.Reset();
+	for (idx_t col_idx = 0; col_idx < lhs_output_columns.col_idxs.size(); col_idx++) {
+		lhs_output.data[col_idx].Reference(input.data[lhs_output_columns.col_idxs[col_idx]]);
+	}
+	lhs_output.data.back().Reference(probe_key_hashes);
+	lhs_output.SetCardinality(input.size());
+}
+
 OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
 	auto &state = state_p.Cast<HashJoinOperatorState>();
@@ -1017,12 +1082,27 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 			sink.hash_table->ProbeAndSpill(state.scan_structure, state.lhs_join_keys, state.join_key_state,
 			                               state.probe_state, input, *sink.probe_spill, state.spill_state,
 			                               state.spill_chunk);
+			if (emit_probe_key_hash) {
+				// compute the hashes over the keys that remained after spilling (ProbeAndSpill sliced them)
+				sink.hash_table->Hash(state.lhs_join_keys, *FlatVector::IncrementalSelectionVector(),
+				                      state.lhs_join_keys.size(), state.probe_key_hashes);
+			}
+		} else if (emit_probe_key_hash) {
+			// hash the keys up front so the hash can be emitted alongside the probe-side columns
+			sink.hash_table->Hash(state.lhs_join_keys, *FlatVector::IncrementalSelectionVector(),
+			                      state.lhs_join_keys.size(), state.probe_key_hashes);
+			sink.hash_table->Probe(state.scan_structure, state.lhs_join_keys, state.join_key_state, state.probe_state,
+			                       &state.probe_key_hashes);
 		} else {
 			sink.hash_table->Probe(state.scan_structure, state.lhs_join_keys, state.join_key_state, state.probe_state);
 		}
 	}
 
-	state.lhs_output.ReferenceColumns(input, lhs_output_columns.col_idxs);
+	if (emit_probe_key_hash) {
+		ReferenceLHSOutputColumns(state.lhs_output, input, state.probe_key_hashes);
+	} else {
+		state.lhs_output.ReferenceColumns(input, lhs_output_columns.col_idxs);
+	}
 	state.scan_structure.Next(state.lhs_join_keys, state.lhs_output, chunk);
 
 	if (state.scan_structure.PointersExhausted() && chunk.size() == 0) {
@@ -1326,7 +1406,13 @@ HashJoinLocalSourceState::HashJoinLocalSourceState(const PhysicalHashJoin &op, c
 
 	lhs_probe_chunk.Initialize(allocator, sink.probe_types);
 	lhs_join_keys.Initialize(allocator, op.condition_types);
-	lhs_output.Initialize(allocator, op.lhs_output_columns.col_types);
+	if (op.emit_probe_key_hash) {
+		auto lhs_output_types = op.lhs_output_columns.col_types;
+		lhs_output_types.push_back(LogicalType::HASH);
+		lhs_output.Initialize(allocator, lhs_output_types);
+	} else {
+		lhs_output.Initialize(allocator, op.lhs_output_columns.col_types);
+	}
 	TupleDataCollection::InitializeChunkState(join_key_state, op.condition_types);
 
 	for (auto &cond : op.conditions) {
@@ -1403,7 +1489,12 @@ void HashJoinLocalSourceState::ExternalProbe(HashJoinGlobalSinkState &sink, Hash
 	// Get the probe chunk columns/hashes
 	lhs_join_keys.Reset();
 	lhs_join_key_executor.Execute(lhs_probe_chunk, lhs_join_keys);
-	lhs_output.ReferenceColumns(lhs_probe_chunk, sink.op.lhs_output_columns.col_idxs);
+	if (sink.op.emit_probe_key_hash) {
+		// the spilled probe data carries the probe key hashes in its last column - emit them directly
+		sink.op.ReferenceLHSOutputColumns(lhs_output, lhs_probe_chunk, lhs_probe_chunk.data.back());
+	} else {
+		lhs_output.ReferenceColumns(lhs_probe_chunk, sink.op.lhs_output_columns.col_idxs);
+	}
 
 	if (sink.hash_table->Count() == 0 && !gstate.op.EmptyResultIfRHSIsEmpty()) {
 		gstate.op.ConstructEmptyJoinResult(sink.hash_table->join_type, sink.hash_table->has_null, lhs_output, chunk);
@@ -851,6 +851,9 @@ public:
 public:
 	idx_t MaxThreads() override {
 		// We can't leverage any more threads than block pairs.
+		// (Block pairs are processed fully in parallel: every worker claims the next pair via the atomic
+		// counter in GetNextPair and runs its own IEJoinUnion, which also carries the per-block bitmap
+		// and bloom-chunk skipping from the IEJoin paper to step over non-matching ranges.)
 		const auto &sink_state = (op.sink_state->Cast<IEJoinGlobalState>());
 		return sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
 	}
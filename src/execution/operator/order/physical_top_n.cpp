@@ -58,6 +58,9 @@ struct TopNBoundaryValue {
 		return boundary_value;
 	}
 
+	//! Feeds the current K-th boundary back into the active scans: the TopN optimizer registered a
+	//! dynamic filter on the first order-by column (see TopN::PushdownDynamicFilters), so table and
+	//! parquet scans prune row groups whose statistics cannot beat the current heap threshold
 	void UpdateValue(string_t boundary_val) {
 		unique_lock<mutex> l(lock);
 		if (!is_set || boundary_val < string_t(boundary_value)) {
@@ -262,6 +265,11 @@ void TopNHeap::AddLargeHeap(DataChunk &input, Vector &sort_keys_vec) {
 	heap_data.Append(input, true, &matching_sel, match_count);
 }
 
+// This is the sink-side pre-filter: every incoming chunk is compared against the current K-th
+// boundary with the vectorized comparison-select kernels (the boundary is broadcast as a constant
+// vector), and only surviving rows reach the heap - after warmup, almost none do. The same boundary
+// also feeds back into the scans as a dynamic filter so row groups that cannot beat it are skipped
+// before their rows are ever produced.
 bool TopNHeap::CheckBoundaryValues(DataChunk &sort_chunk, DataChunk &payload, TopNBoundaryValue &global_boundary) {
 	// get the global boundary value
 	auto current_boundary_val = global_boundary.GetBoundaryValue();
@@ -31,6 +31,11 @@ PhysicalBatchInsert::PhysicalBatchInsert(LogicalOperator &op, SchemaCatalogEntry
 //===--------------------------------------------------------------------===//
 // CollectionMerger
 //===--------------------------------------------------------------------===//
+// Sink threads append to private, per-batch RowGroupCollections without taking the global lock; the
+// lock is only grabbed when a completed batch is registered. Completed batches are written out
+// optimistically and stitched into local storage by reference at finalize (LocalMerge). The scan-and-
+// re-append below is therefore not a synchronization cost but deliberate compaction: it packs the
+// partial row groups of small batches into full ones before they are flushed.
 enum class RowGroupBatchType : uint8_t { FLUSHED, NOT_FLUSHED };
 
 class CollectionMerger {
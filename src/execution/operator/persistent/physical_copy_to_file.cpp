@@ -64,7 +64,11 @@ public:
 	shared_ptr<GlobalHivePartitionState> partition_state;
 	//! Written file info and stats
 	vector<unique_ptr<CopyToFileInfo>> written_files;
-	//! Max open files
+	//! Max open files. Large partition counts are kept stable by three bounds working together: sink
+	//! threads pre-partition locally into buffer-managed HivePartitionedColumnData, the per-thread
+	//! buffers flush once partitioned_write_flush_threshold rows accumulate, and the writer pool below
+	//! finalizes idle writers when it reaches max_open_files - so neither partition buffers nor file
+	//! handles grow with the partition count.
 	idx_t max_open_files;
 	//! If rotate is true, this lock is used
 	unique_ptr<StorageLock> file_write_lock_if_rotating;
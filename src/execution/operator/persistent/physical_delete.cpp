@@ -24,8 +24,8 @@ PhysicalDelete::PhysicalDelete(vector<LogicalType> types, TableCatalogEntry &tab
 //===--------------------------------------------------------------------===//
 class DeleteGlobalState : public GlobalSinkState {
 public:
-	explicit DeleteGlobalState(ClientContext &context, const vector<LogicalType> &return_types,
-	                           TableCatalogEntry &table, const vector<unique_ptr<BoundConstraint>> &bound_constraints)
+	DeleteGlobalState(ClientContext &context, const vector<LogicalType> &return_types, TableCatalogEntry &table,
+	                  const vector<unique_ptr<BoundConstraint>> &bound_constraints, bool return_chunk)
 	    : deleted_count(0), return_collection(context, return_types), has_unique_indexes(false) {
 
 		// We need to append deletes to the local delete-ART.
@@ -34,13 +34,54 @@ public:
 			storage.InitializeLocalStorage(delete_index_append_state, table, context, bound_constraints);
 			has_unique_indexes = true;
 		}
+
+		// The set of columns to fetch for RETURNING / delete-index maintenance is invariant across
+		// chunks - compute it once here instead of for every chunk inside the sink's critical section.
+		auto types = table.GetTypes();
+		to_be_fetched = vector<bool>(types.size(), return_chunk);
+		if (return_chunk) {
+			// Fetch all columns.
+			column_types = types;
+			for (idx_t i = 0; i < storage.ColumnCount(); i++) {
+				column_ids.emplace_back(i);
+			}
+		} else if (has_unique_indexes) {
+			// Fetch only the required columns for updating the delete indexes.
+			auto &local_storage = LocalStorage::Get(context, storage.db);
+			auto local_table_storage = local_storage.GetStorage(storage);
+			unordered_set<column_t> indexed_column_id_set;
+			local_table_storage->delete_indexes.Scan([&](Index &index) {
+				if (!index.IsBound() || !index.IsUnique()) {
+					return false;
+				}
+				auto &set = index.GetColumnIdSet();
+				indexed_column_id_set.insert(set.begin(), set.end());
+				return false;
+			});
+			for (auto &col : indexed_column_id_set) {
+				column_ids.emplace_back(col);
+			}
+			sort(column_ids.begin(), column_ids.end());
+			for (auto &col : column_ids) {
+				auto i = col.GetPrimaryIndex();
+				to_be_fetched[i] = true;
+				column_types.push_back(types[i]);
+			}
+		}
 	}
 
+	//! Serializes the sink: deletes append undo entries to the transaction's single UndoBuffer, which is
+	//! not synchronized. Row-group version info has its own per-row-group lock, so the apply itself could
+	//! run in parallel once undo allocation is - until then this lock covers the whole delete.
 	mutex delete_lock;
 	idx_t deleted_count;
 	ColumnDataCollection return_collection;
 	LocalAppendState delete_index_append_state;
 	bool has_unique_indexes;
+	//! Which columns are fetched into the delete chunk (all for RETURNING, indexed ones otherwise)
+	vector<bool> to_be_fetched;
+	vector<StorageIndex> column_ids;
+	vector<LogicalType> column_types;
 };
 
 class DeleteLocalState : public LocalSinkState {
@@ -74,53 +115,20 @@ SinkResultType PhysicalDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 	}
 
 	auto types = table.GetTypes();
-	auto to_be_fetched = vector<bool>(types.size(), return_chunk);
-	vector<StorageIndex> column_ids;
-	vector<LogicalType> column_types;
-	if (return_chunk) {
-		// Fetch all columns.
-		column_types = types;
-		for (idx_t i = 0; i < table.ColumnCount(); i++) {
-			column_ids.emplace_back(i);
-		}
-
-	} else {
-		// Fetch only the required columns for updating the delete indexes.
-		auto &local_storage = LocalStorage::Get(context.client, table.db);
-		auto storage = local_storage.GetStorage(table);
-		unordered_set<column_t> indexed_column_id_set;
-		storage->delete_indexes.Scan([&](Index &index) {
-			if (!index.IsBound() || !index.IsUnique()) {
-				return false;
-			}
-			auto &set = index.GetColumnIdSet();
-			indexed_column_id_set.insert(set.begin(), set.end());
-			return false;
-		});
-		for (auto &col : indexed_column_id_set) {
-			column_ids.emplace_back(col);
-		}
-		sort(column_ids.begin(), column_ids.end());
-		for (auto &col : column_ids) {
-			auto i = col.GetPrimaryIndex();
-			to_be_fetched[i] = true;
-			column_types.push_back(types[i]);
-		}
-	}
 
 	l_state.delete_chunk.Reset();
 	row_ids.Flatten(chunk.size());
 
 	// Fetch the to-be-deleted chunk.
 	DataChunk fetch_chunk;
-	fetch_chunk.Initialize(Allocator::Get(context.client), column_types, chunk.size());
+	fetch_chunk.Initialize(Allocator::Get(context.client), g_state.column_types, chunk.size());
 	auto fetch_state = ColumnFetchState();
-	table.Fetch(transaction, fetch_chunk, column_ids, row_ids, chunk.size(), fetch_state);
+	table.Fetch(transaction, fetch_chunk, g_state.column_ids, row_ids, chunk.size(), fetch_state);
 
 	// Reference the necessary columns of the fetch_chunk.
 	idx_t fetch_idx = 0;
 	for (idx_t i = 0; i < table.ColumnCount(); i++) {
-		if (to_be_fetched[i]) {
+		if (g_state.to_be_fetched[i]) {
 			l_state.delete_chunk.data[i].Reference(fetch_chunk.data[fetch_idx++]);
 			continue;
 		}
@@ -157,7 +165,7 @@ SinkResultType PhysicalDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 }
 
 unique_ptr<GlobalSinkState> PhysicalDelete::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<DeleteGlobalState>(context, GetTypes(), tableref, bound_constraints);
+	return make_uniq<DeleteGlobalState>(context, GetTypes(), tableref, bound_constraints, return_chunk);
 }
 
 unique_ptr<LocalSinkState> PhysicalDelete::GetLocalSinkState(ExecutionContext &context) const {
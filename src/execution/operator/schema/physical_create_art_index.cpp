@@ -103,6 +103,8 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(OperatorSinkInput &input) co
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+//! Bulk-load path: the planner sorts the keys below this operator, each chunk is built directly into an
+//! ART via the recursive sorted Construct (no per-key node splitting), and the per-chunk ARTs are merged
 SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) const {
 
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
@@ -178,6 +178,9 @@ SourceResultType PhysicalRecursiveCTE::GetData(ExecutionContext &context, DataCh
 				}
 			}
 
+			// This is semi-naive evaluation: the working table handed to the recursive side holds only
+			// this iteration's delta - rows the persistent dedup hash table has not seen before - never
+			// the accumulated result, so iteration cost tracks the frontier size rather than the total
 			working_table->Reset();
 			working_table->Combine(gstate.intermediate_table);
 			// and we clear the intermediate table
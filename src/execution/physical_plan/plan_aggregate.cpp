@@ -4,6 +4,7 @@
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_partitioned_aggregate.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -12,19 +13,11 @@
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 
 namespace duckdb {
 
-static uint32_t RequiredBitsForValue(uint32_t n) {
-	idx_t required_bits = 0;
-	while (n > 0) {
-		n >>= 1;
-		required_bits++;
-	}
-	return UnsafeNumericCast<uint32_t>(required_bits);
-}
-
 template <class T>
 hugeint_t GetRangeHugeint(const BaseStatistics &nstats) {
 	return Hugeint::Convert(NumericStats::GetMax<T>(nstats)) - Hugeint::Convert(NumericStats::GetMin<T>(nstats));
@@ -112,11 +105,14 @@ static bool CanUsePartitionedAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
-static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &bits_per_group) {
+static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &group_ranges) {
 	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
 		return false;
 	}
-	idx_t perfect_hash_bits = 0;
+	// the per-column ranges are composed into one dense offset, so the combined domain (their product) must
+	// fit within the perfect hash threshold
+	const idx_t max_total_range = idx_t(1) << ClientConfig::GetConfig(context).perfect_ht_threshold;
+	idx_t total_range = 1;
 	if (op.group_stats.empty()) {
 		op.group_stats.resize(op.groups.size());
 	}
@@ -213,15 +209,13 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 		}
 
 		range += 2;
-		// figure out how many bits we need
-		idx_t required_bits = RequiredBitsForValue(UnsafeNumericCast<uint32_t>(range));
-		bits_per_group.push_back(required_bits);
-		perfect_hash_bits += required_bits;
-		// check if we have exceeded the bits for the hash
-		if (perfect_hash_bits > ClientConfig::GetConfig(context).perfect_ht_threshold) {
-			// too many bits for perfect hash
+		// check if the combined domain still fits within the perfect hash threshold
+		if (range > max_total_range / total_range) {
+			// the combined domain is too large for a perfect hash
 			return false;
 		}
+		total_range *= range;
+		group_ranges.push_back(range);
 	}
 	for (auto &expression : op.expressions) {
 		auto &aggregate = expression->Cast<BoundAggregateExpression>();
@@ -233,10 +227,71 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Check whether the aggregate groups are exactly the probe keys of a child hash join, in which case the join
+//! can emit the probe key hash and the aggregate's hash table can reuse it instead of rehashing the groups
+static bool CanReuseJoinHashForAggregate(LogicalAggregate &op, PhysicalOperator &plan) {
+	if (op.groups.empty() || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (op.grouping_sets.size() > 1 ||
+	    (op.grouping_sets.size() == 1 && op.grouping_sets[0].size() != op.groups.size())) {
+		return false;
+	}
+	if (plan.type != PhysicalOperatorType::HASH_JOIN) {
+		return false;
+	}
+	auto &join = plan.Cast<PhysicalHashJoin>();
+	if (join.join_type != JoinType::INNER || join.conditions.size() != op.groups.size()) {
+		return false;
+	}
+	for (auto &expr : op.expressions) {
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.order_bys) {
+			return false;
+		}
+	}
+	// the groups must reference exactly the probe keys, in the same order, so that the combined hash is identical
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		auto &group = *op.groups[group_idx];
+		if (group.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		const auto output_idx = group.Cast<BoundReferenceExpression>().index;
+		if (output_idx >= join.lhs_output_columns.col_idxs.size()) {
+			// not a probe-side output column
+			return false;
+		}
+		auto &condition = join.conditions[group_idx];
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL ||
+		    condition.left->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return false;
+		}
+		if (condition.left->Cast<BoundReferenceExpression>().index != join.lhs_output_columns.col_idxs[output_idx]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Increment all bound references at or beyond "insert_idx" to account for an inserted column
+static void ShiftBoundReferences(Expression &expr, const idx_t insert_idx) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		auto &ref = expr.Cast<BoundReferenceExpression>();
+		if (ref.index >= insert_idx) {
+			ref.index++;
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { ShiftBoundReferences(child, insert_idx); });
+}
+
 PhysicalOperator &PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	D_ASSERT(op.children.size() == 1);
 
 	reference<PhysicalOperator> plan = CreatePlan(*op.children[0]);
+	// check before ExtractAggregateExpressions below, which moves the group expressions into a projection
+	const bool can_reuse_join_hash = CanReuseJoinHashForAggregate(op, plan);
+	auto &aggregate_child = plan.get();
 	plan = ExtractAggregateExpressions(plan, op.expressions, op.groups);
 
 	bool can_use_simple_aggregation = true;
@@ -267,7 +322,7 @@ PhysicalOperator &PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	// groups! create a GROUP BY aggregator
 	// use a partitioned or perfect hash aggregate if possible
 	vector<column_t> partition_columns;
-	vector<idx_t> required_bits;
+	vector<idx_t> group_ranges;
 	if (can_use_simple_aggregation && CanUsePartitionedAggregate(context, op, plan, partition_columns)) {
 		auto &group_by =
 		    Make<PhysicalPartitionedAggregate>(context, op.types, std::move(op.expressions), std::move(op.groups),
@@ -276,17 +331,39 @@ PhysicalOperator &PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 		return group_by;
 	}
 
-	if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+	if (CanUsePerfectHashAggregate(context, op, group_ranges)) {
 		auto &group_by = Make<PhysicalPerfectHashAggregate>(context, op.types, std::move(op.expressions),
 		                                                    std::move(op.groups), std::move(op.group_stats),
-		                                                    std::move(required_bits), op.estimated_cardinality);
+		                                                    std::move(group_ranges), op.estimated_cardinality);
 		group_by.children.push_back(plan);
 		return group_by;
 	}
 
+	optional_idx precomputed_hash_column;
+	if (can_reuse_join_hash && plan.get().type == PhysicalOperatorType::PROJECTION) {
+		// the aggregate groups by exactly the probe keys of the child hash join: let the join emit the hash of
+		// the probe keys and pass it through the projection, so the aggregate does not have to rehash the groups
+		auto &join = aggregate_child.Cast<PhysicalHashJoin>();
+		auto &projection = plan.get().Cast<PhysicalProjection>();
+		const auto hash_col_idx = join.lhs_output_columns.col_idxs.size();
+		join.emit_probe_key_hash = true;
+		join.types.insert(join.types.begin() + NumericCast<int64_t>(hash_col_idx), LogicalType::HASH);
+		for (auto &expr : projection.select_list) {
+			ShiftBoundReferences(*expr, hash_col_idx);
+		}
+		precomputed_hash_column = projection.select_list.size();
+		projection.select_list.push_back(make_uniq<BoundReferenceExpression>(LogicalType::HASH, hash_col_idx));
+		projection.types.push_back(LogicalType::HASH);
+	}
+
 	auto &group_by = Make<PhysicalHashAggregate>(context, op.types, std::move(op.expressions), std::move(op.groups),
 	                                             std::move(op.grouping_sets), std::move(op.grouping_functions),
 	                                             op.estimated_cardinality);
+	if (precomputed_hash_column.IsValid()) {
+		auto &hash_aggr = group_by.Cast<PhysicalHashAggregate>();
+		D_ASSERT(hash_aggr.groupings.size() == 1);
+		hash_aggr.groupings[0].table_data.precomputed_hash_column = precomputed_hash_column;
+	}
 	group_by.children.push_back(plan);
 	return group_by;
 }
@@ -523,7 +523,12 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
+	if (precomputed_hash_column.IsValid()) {
+		// the child operator already computed the group hashes - add the chunk without rehashing
+		ht.AddChunk(group_chunk, chunk.data[precomputed_hash_column.GetIndex()], payload_input, filter);
+	} else {
+		ht.AddChunk(group_chunk, payload_input, filter);
+	}
 
 	// Decide whether we should adapt our strategy to the data
 	if (!lstate.adapted && lstate.ht->GetSinkCount() >= RadixHTLocalSinkState::ADAPTIVITY_THRESHOLD) {
@@ -593,6 +598,48 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 	gstate.stored_allocators_size += gstate.stored_allocators.back()->AllocationSize();
 }
 
+//! By how many radix bits to split a partition that exceeds the finalize memory budget (4-way),
+//! applied recursively up to RadixPartitioning::MAX_RADIX_BITS
+static constexpr idx_t FINALIZE_REPARTITION_RADIX_BITS = 2;
+
+static idx_t AggregatePartitionSize(TupleDataCollection &data) {
+	return data.SizeInBytes() + GroupedAggregateHashTable::GetCapacityForCount(data.Count()) * sizeof(ht_entry_t);
+}
+
+//! Add a partition to the list of partitions to be finalized. If the partition exceeds the per-thread memory
+//! budget (e.g. because of a heavily skewed group key), it is recursively repartitioned on the next radix
+//! bits first, so we never build one giant hash table - the sub-partitions stay buffer-managed and can be
+//! offloaded to temporary files independently
+static void AddFinalizePartition(ClientContext &context, RadixHTGlobalSinkState &gstate,
+                                 unique_ptr<TupleDataCollection> data, idx_t radix_bits,
+                                 idx_t partition_size_limit) {
+	const auto partition_size = AggregatePartitionSize(*data);
+	if (partition_size > partition_size_limit &&
+	    radix_bits + FINALIZE_REPARTITION_RADIX_BITS <= RadixPartitioning::MAX_RADIX_BITS) {
+		const auto new_radix_bits = radix_bits + FINALIZE_REPARTITION_RADIX_BITS;
+		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		const auto hash_col_idx = gstate.radix_ht.GetLayout().ColumnCount() - 1;
+
+		// wrap the data in a single-partition radix container so we can use Repartition to split it
+		RadixPartitionedTupleData old_partitioned(buffer_manager, gstate.radix_ht.GetLayoutPtr(), 0, hash_col_idx);
+		old_partitioned.GetPartitions()[0] = std::move(data);
+
+		RadixPartitionedTupleData repartitioned(buffer_manager, gstate.radix_ht.GetLayoutPtr(), new_radix_bits,
+		                                        hash_col_idx);
+		old_partitioned.Repartition(context, repartitioned);
+
+		for (auto &sub_partition : repartitioned.GetPartitions()) {
+			if (sub_partition->Count() == 0) {
+				continue;
+			}
+			AddFinalizePartition(context, gstate, std::move(sub_partition), new_radix_bits, partition_size_limit);
+		}
+		return;
+	}
+	gstate.max_partition_size = MaxValue(gstate.max_partition_size, partition_size);
+	gstate.partitions.emplace_back(make_uniq<AggregatePartition>(std::move(data)));
+}
+
 void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState &gstate_p) const {
 	auto &gstate = gstate_p.Cast<RadixHTGlobalSinkState>();
 
@@ -603,22 +650,29 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 		// If true there is no need to combine, it was all done by a single thread in a single HT
 		const auto single_ht = !gstate.external && gstate.active_threads == 1 && gstate.number_of_threads == 1;
 
+		// the same per-thread memory bound that the finalize tasks use to limit their HT allocation -
+		// partitions larger than this are recursively split before they are finalized
+		const auto n_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		const auto memory_limit = BufferManager::GetBufferManager(context).GetMaxMemory();
+		const auto partition_size_limit = LossyNumericCast<idx_t>(0.6 * double(memory_limit) / double(n_threads));
+
 		auto &uncombined_partition_data = uncombined_data.GetPartitions();
 		const auto n_partitions = uncombined_partition_data.size();
 		gstate.partitions.reserve(n_partitions);
 		for (idx_t i = 0; i < n_partitions; i++) {
 			auto &partition = uncombined_partition_data[i];
-			auto partition_size =
-			    partition->SizeInBytes() +
-			    GroupedAggregateHashTable::GetCapacityForCount(partition->Count()) * sizeof(ht_entry_t);
+			if (!single_ht) {
+				AddFinalizePartition(context, gstate, std::move(partition), gstate.config.GetRadixBits(),
+				                     partition_size_limit);
+				continue;
+			}
+			auto partition_size = AggregatePartitionSize(*partition);
 			gstate.max_partition_size = MaxValue(gstate.max_partition_size, partition_size);
 
 			gstate.partitions.emplace_back(make_uniq<AggregatePartition>(std::move(partition)));
-			if (single_ht) {
-				gstate.finalize_done++;
-				gstate.partitions.back()->progress = 1;
-				gstate.partitions.back()->state = AggregatePartitionState::READY_TO_SCAN;
-			}
+			gstate.finalize_done++;
+			gstate.partitions.back()->progress = 1;
+			gstate.partitions.back()->state = AggregatePartitionState::READY_TO_SCAN;
 		}
 	} else {
 		gstate.count_before_combining = 0;
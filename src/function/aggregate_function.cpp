@@ -2,6 +2,12 @@
 
 namespace duckdb {
 
+// Note on incremental view maintenance over the combine interface: combine() merges partial states of
+// the SAME direction - it cannot retract rows, so deletes/updates would require invertible states
+// (impossible for min/max without auxiliary structures). Materialized views additionally need a catalog
+// object, DDL, persistence of aggregate states, and commit-time delta hooks; none of that infrastructure
+// exists in this tree, so summary maintenance has to remain query-driven.
+
 AggregateFunctionInfo::~AggregateFunctionInfo() {
 }
 
@@ -47,6 +47,12 @@ static void FillExtraInfo(const StaticFunctionDefinition &function, T &info) {
 	OP::FillExtraInfo(info);
 }
 
+// The static list is materialized once per database instance into the system catalog (sessions share
+// it), so this registration is a bounded one-time cost rather than per-connection work. Deferring it
+// further via the catalog's default-generator mechanism (materialize on first bind) is possible in
+// principle, but any catalog enumeration - duckdb_functions(), autocomplete, conflict checks on
+// CREATE FUNCTION - forces full materialization anyway, so the savings only last until the first of
+// those and the alias/conflict handling below would need to move into the generator.
 template <class OP, class REGISTER_CONTEXT>
 static void RegisterFunctionList(REGISTER_CONTEXT &context, const StaticFunctionDefinition *functions) {
 	for (idx_t i = 0; functions[i].name; i++) {
@@ -822,6 +822,11 @@ unique_ptr<FunctionData> BindDecimalMultiply(ClientContext &context, ScalarFunct
 		    "or add an explicit cast to a decimal with a lower scale.",
 		    result_scale, Decimal::MAX_WIDTH_DECIMAL);
 	}
+	// this is the int64 fast path: when the inputs fit int64 but the conservative result width would
+	// not, we keep the computation in int64 with runtime overflow checks instead of promoting to
+	// hugeint - the overwhelmingly common case never touches hugeint emulation. On actual overflow we
+	// must throw rather than redo the vector in hugeint: the result's decimal width is part of the
+	// statically bound result type, so a wider result cannot be produced at runtime
 	if (result_width > Decimal::MAX_WIDTH_INT64 && max_width <= Decimal::MAX_WIDTH_INT64 &&
 	    result_scale < Decimal::MAX_WIDTH_INT64) {
 		bind_data->check_overflow = true;
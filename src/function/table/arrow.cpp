@@ -101,6 +101,10 @@ idx_t ArrowTableFunction::ArrowScanMaxThreads(ClientContext &context, const Func
 	return context.db->NumberOfThreads();
 }
 
+// Record batches are converted in parallel: only pulling the next batch from the Arrow stream happens
+// under the lock below, while the conversion to DataChunks (including the dictionary mapping, which
+// reuses a per-state dictionary cache so dictionary-encoded columns become DuckDB dictionary vectors
+// rather than being decoded) runs on each scan thread independently.
 bool ArrowTableFunction::ArrowScanParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
                                                     ArrowScanLocalState &state, ArrowScanGlobalState &parallel_state) {
 	lock_guard<mutex> parallel_lock(parallel_state.main_mutex);
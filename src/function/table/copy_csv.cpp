@@ -230,6 +230,52 @@ static unique_ptr<FunctionData> WriteCSVBind(ClientContext &context, CopyFunctio
 	if (!bind_data->options.write_newline.empty()) {
 		bind_data->newline = TransformNewLine(bind_data->options.write_newline);
 	}
+
+	// determine per column whether the rendered text can ever require quoting: numeric and date/time
+	// renderings draw from a small, known character set, so if none of those characters require quotes
+	// (and the null string cannot collide with a rendering - it is either empty or contains a character
+	// outside the set), the per-value quote scan can be skipped entirely for the column
+	bind_data->never_requires_quotes.resize(sql_types.size(), false);
+	for (idx_t col_idx = 0; col_idx < sql_types.size(); col_idx++) {
+		string type_chars;
+		switch (sql_types[col_idx].id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::BIGINT:
+		case LogicalTypeId::HUGEINT:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+		case LogicalTypeId::UBIGINT:
+		case LogicalTypeId::UHUGEINT:
+			type_chars = "0123456789-";
+			break;
+		case LogicalTypeId::DATE:
+			// includes the characters of BC dates ("... (BC)") and of "(-)infinity"
+			type_chars = "0123456789- (BC)infty";
+			break;
+		case LogicalTypeId::TIME:
+			type_chars = "0123456789:.";
+			break;
+		default:
+			// other types (including floating point, which can render special values) keep the scan
+			continue;
+		}
+		bool never_quotes = true;
+		for (const auto c : type_chars) {
+			if (bind_data->requires_quotes[NumericCast<idx_t>(static_cast<unsigned char>(c))]) {
+				never_quotes = false;
+				break;
+			}
+		}
+		// the null string must not be producible by this rendering
+		auto &null_str = bind_data->options.null_str[0];
+		if (!null_str.empty() && null_str.find_first_not_of(type_chars) == string::npos) {
+			never_quotes = false;
+		}
+		bind_data->never_requires_quotes[col_idx] = never_quotes;
+	}
 	return std::move(bind_data);
 }
 
@@ -460,9 +506,11 @@ static void WriteCSVChunkInternal(ClientContext &context, FunctionData &bind_dat
 
 			// non-null value, fetch the string value from the cast chunk
 			auto str_data = FlatVector::GetData<string_t>(cast_chunk.data[col_idx]);
-			// FIXME: we could gain some performance here by checking for certain types if they ever require quotes
-			// (e.g. integers only require quotes if the delimiter is a number, decimals only require quotes if the
-			// delimiter is a number or "." character)
+			if (csv_data.never_requires_quotes[col_idx] && !csv_data.options.force_quote[col_idx]) {
+				// the rendered text of this column's type can never require quoting - write it directly
+				writer.WriteData(const_data_ptr_cast(str_data[row_idx].GetData()), str_data[row_idx].GetSize());
+				continue;
+			}
 			WriteQuotedString(writer, csv_data, str_data[row_idx].GetData(), str_data[row_idx].GetSize(),
 			                  csv_data.options.force_quote[col_idx]);
 		}
@@ -0,0 +1,74 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+
+namespace duckdb {
+
+struct DuckDBMemoryDetailData : public GlobalTableFunctionState {
+	DuckDBMemoryDetailData() : offset(0) {
+	}
+
+	vector<BufferPool::EvictionQueueStats> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBMemoryDetailBind(ClientContext &context, TableFunctionBindInput &input,
+                                                       vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("eviction_queue");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_types");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("approximate_size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("total_insertions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("dead_nodes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBMemoryDetailInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBMemoryDetailData>();
+	result->entries = DatabaseInstance::GetDatabase(context).GetBufferPool().GetEvictionQueueStats();
+	return std::move(result);
+}
+
+void DuckDBMemoryDetailFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBMemoryDetailData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset];
+		idx_t col = 0;
+		// eviction_queue, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(data.offset)));
+		// buffer_types, VARCHAR
+		output.SetValue(col++, count, entry.buffer_types);
+		// approximate_size, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.approximate_size));
+		// total_insertions, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.total_insertions));
+		// dead_nodes, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.total_dead_nodes));
+		data.offset++;
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBMemoryDetailFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_memory_detail", {}, DuckDBMemoryDetailFunction, DuckDBMemoryDetailBind,
+	                              DuckDBMemoryDetailInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,100 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBObjectCacheData : public GlobalTableFunctionState {
+	DuckDBObjectCacheData() : offset(0) {
+	}
+
+	vector<pair<string, shared_ptr<ObjectCacheEntry>>> entries;
+	ObjectCacheStats stats;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBObjectCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("key");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("object_type");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cache_hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cache_misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cache_evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cache_size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("cache_capacity");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBObjectCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBObjectCacheData>();
+	auto &cache = ObjectCache::GetObjectCache(context);
+	result->entries = cache.GetEntries();
+	result->stats = cache.GetStats();
+	return std::move(result);
+}
+
+void DuckDBObjectCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBObjectCacheData>();
+	// we always return at least one row, so an empty cache still exposes its statistics
+	const auto total_rows = MaxValue<idx_t>(data.entries.size(), 1);
+	if (data.offset >= total_rows) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < total_rows && count < STANDARD_VECTOR_SIZE) {
+		idx_t col = 0;
+		if (data.offset < data.entries.size()) {
+			auto &entry = data.entries[data.offset];
+			// key, VARCHAR
+			output.SetValue(col++, count, entry.first);
+			// object_type, VARCHAR
+			output.SetValue(col++, count, entry.second->GetObjectType());
+			// size, UBIGINT
+			output.SetValue(col++, count, Value::UBIGINT(entry.second->GetObjectSize()));
+		} else {
+			// empty cache: emit a single row holding only the statistics
+			output.SetValue(col++, count, Value());
+			output.SetValue(col++, count, Value());
+			output.SetValue(col++, count, Value());
+		}
+		// cache_hits, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(data.stats.hits));
+		// cache_misses, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(data.stats.misses));
+		// cache_evictions, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(data.stats.evictions));
+		// cache_size, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(data.stats.current_size));
+		// cache_capacity, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(data.stats.capacity));
+		data.offset++;
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBObjectCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_object_cache", {}, DuckDBObjectCacheFunction, DuckDBObjectCacheBind, DuckDBObjectCacheInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,69 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/query_log.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/client_context.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryLogData : public GlobalTableFunctionState {
+	DuckDBQueryLogData() : offset(0) {
+	}
+
+	vector<QueryLog::Entry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryLogBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("query");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("start_time");
+	return_types.emplace_back(LogicalType::TIMESTAMP);
+
+	names.emplace_back("duration_ms");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("success");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryLogInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryLogData>();
+	result->entries = DatabaseInstance::GetDatabase(context).GetQueryLog().GetEntries();
+	return std::move(result);
+}
+
+void DuckDBQueryLogFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryLogData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		idx_t col = 0;
+		// query, VARCHAR
+		output.SetValue(col++, count, entry.query);
+		// start_time, TIMESTAMP
+		output.SetValue(col++, count, Value::TIMESTAMP(entry.start_time));
+		// duration_ms, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(entry.duration_ms));
+		// success, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(entry.success));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryLogFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_query_log", {}, DuckDBQueryLogFunction, DuckDBQueryLogBind, DuckDBQueryLogInit));
+}
+
+} // namespace duckdb
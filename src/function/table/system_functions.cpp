@@ -32,6 +32,9 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 	DuckDBExtensionsFun::RegisterFunction(*this);
 	DuckDBMemoryFun::RegisterFunction(*this);
 	DuckDBExternalFileCacheFun::RegisterFunction(*this);
+	DuckDBObjectCacheFun::RegisterFunction(*this);
+	DuckDBQueryLogFun::RegisterFunction(*this);
+	DuckDBMemoryDetailFun::RegisterFunction(*this);
 	DuckDBOptimizersFun::RegisterFunction(*this);
 	DuckDBSecretsFun::RegisterFunction(*this);
 	DuckDBWhichSecretFun::RegisterFunction(*this);
@@ -480,6 +480,10 @@ void WindowSegmentTreePart::EvaluateUpperLevels(const WindowSegmentTreeGlobalSta
 
 	//	Share adjacent identical states
 	//  We do this first because we want to share only tree aggregations
+	//  This is the frame memoization for RANGE frames over duplicate order values: runs of rows with
+	//  the same frame bounds (thousands of rows per timestamp) evaluate the tree aggregation once and
+	//  share the resulting state, and the boundary computation itself seeds its binary searches from
+	//  the previous row's bounds, so identical frames are detected without re-searching
 	idx_t prev_begin = 1;
 	idx_t prev_end = 0;
 	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
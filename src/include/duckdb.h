@@ -3387,6 +3387,29 @@ Sets the (optional) bind function of the scalar function.
 DUCKDB_C_API void duckdb_scalar_function_set_bind(duckdb_scalar_function scalar_function,
                                                   duckdb_scalar_function_bind_t bind);
 
+/*!
+Returns the number of arguments the scalar function is bound to.
+
+* @param info The bind info of the scalar function.
+* @return The number of bound arguments.
+*/
+DUCKDB_C_API idx_t duckdb_scalar_function_bind_get_argument_count(duckdb_bind_info info);
+
+/*!
+Returns the value of a constant (foldable) argument of the scalar function, or NULL if the argument at
+this index is not constant. This allows bind callbacks to specialize on constant arguments - e.g.
+compiling a regex pattern once at bind time and storing it in the bind data - instead of re-validating
+them for every execution.
+
+The result must be destroyed with `duckdb_destroy_value`.
+
+* @param info The bind info of the scalar function.
+* @param index The argument index.
+* @return The constant argument value, or NULL if the argument is not constant. Must be destroyed with
+`duckdb_destroy_value`.
+*/
+DUCKDB_C_API duckdb_value duckdb_scalar_function_bind_get_constant_argument(duckdb_bind_info info, idx_t index);
+
 /*!
 Sets the user-provided bind data in the bind object of the scalar function.
 This object can be retrieved again during execution.
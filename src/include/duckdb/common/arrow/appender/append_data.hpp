@@ -138,6 +138,18 @@ static void AppendValidity(ArrowAppendData &append_data, UnifiedVectorFormat &fo
 	uint8_t current_bit;
 	idx_t current_byte;
 	GetBitPosition(append_data.row_count, current_byte, current_bit);
+	if (!format.sel->IsSet() && current_bit == 0 && from % 8 == 0 && format.validity.GetData()) {
+		// flat vector with byte-aligned source and destination: copy the mask bytes directly - DuckDB
+		// and Arrow both store validity LSB-first with a set bit meaning valid
+		auto source_data = reinterpret_cast<const uint8_t *>(format.validity.GetData());
+		memcpy(validity_data + current_byte, source_data + from / 8, (size + 7) / 8);
+		if (size % 8 != 0) {
+			// bits beyond "size" in the last byte belong to future rows - they must stay all-valid,
+			// as the slow path below only ever unsets bits
+			validity_data[current_byte + size / 8] |= UnsafeNumericCast<uint8_t>(0xFF << (size % 8));
+		}
+		return;
+	}
 	for (idx_t i = from; i < to; i++) {
 		auto source_idx = format.sel->get_index(i);
 		// append the validity mask
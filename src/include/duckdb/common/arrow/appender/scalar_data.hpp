@@ -104,6 +104,13 @@ struct ArrowScalarBaseData {
 		auto data = UnifiedVectorFormat::GetData<SRC>(format);
 		auto result_data = main_buffer.GetData<TGT>();
 
+		if (std::is_same<TGT, SRC>::value && std::is_same<OP, ArrowScalarConverter>::value && !format.sel->IsSet()) {
+			// flat vector without conversion: copy the values wholesale instead of per row
+			memcpy(result_data + append_data.row_count, data + from, size * sizeof(TGT));
+			append_data.row_count += size;
+			return;
+		}
+
 		for (idx_t i = from; i < to; i++) {
 			auto source_idx = format.sel->get_index(i);
 			auto result_idx = append_data.row_count + i - from;
@@ -24,6 +24,12 @@ enum class MemoryTag : uint8_t {
 	OVERFLOW_STRINGS = 8,
 	IN_MEMORY_TABLE = 9,
 	ALLOCATOR = 10,
+	// Buffer-managed extension allocations carry this tag and show up as one line in duckdb_memory().
+	// Finer attribution (which extension) would need a current-extension context switched at every
+	// entry point into extension code - extensions allocate from arbitrary call paths, so tags cannot
+	// be derived from the allocation site alone. CPU attribution is already approximated by the
+	// profiler's per-operator timings, which cover extension-registered functions under the operators
+	// that invoke them.
 	EXTENSION = 11,
 	TRANSACTION = 12,
 	EXTERNAL_FILE_CACHE = 13,
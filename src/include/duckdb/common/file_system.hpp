@@ -63,6 +63,12 @@ public:
 	// Read at [nr_bytes] bytes into [buffer], and return the bytes actually read.
 	// File offset will be changed, which advances for number of bytes read.
 	DUCKDB_API int64_t Read(void *buffer, idx_t nr_bytes);
+	//! Advise the file system that [nr_bytes] at [location] will be read soon (best-effort, see FileSystem)
+	DUCKDB_API void ReadAhead(idx_t location, idx_t nr_bytes);
+	//! Memory-map the file through the handle's concrete file system (nullptr if unsupported)
+	DUCKDB_API data_ptr_t MemoryMap(idx_t nr_bytes);
+	//! Release a mapping obtained from MemoryMap
+	DUCKDB_API void MemoryUnmap(data_ptr_t pointer, idx_t nr_bytes);
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	// Read at [nr_bytes] bytes into [buffer].
 	// File offset will not be changed.
@@ -139,6 +145,15 @@ public:
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
+	//! Advise the file system that the given range will be read soon: a best-effort hint that allows the file
+	//! system to start reading asynchronously (e.g. kernel readahead) so the data is in flight before the
+	//! blocking Read. The default implementation is a no-op.
+	DUCKDB_API virtual void ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes);
+	//! Memory-map the first nr_bytes of the file for reading. Returns nullptr if the file system does not
+	//! support memory mapping (the default). A successful mapping must be released with MemoryUnmap.
+	DUCKDB_API virtual data_ptr_t MemoryMap(FileHandle &handle, idx_t nr_bytes);
+	//! Release a mapping obtained from MemoryMap
+	DUCKDB_API virtual void MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes);
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	DUCKDB_API virtual int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes);
 	//! Excise a range of the file. The OS can drop pages from the page-cache, and the file-system is free to deallocate
@@ -27,6 +27,11 @@ public:
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	//! Start kernel readahead for the given range (Linux only, best-effort)
+	void ReadAhead(FileHandle &handle, idx_t location, idx_t nr_bytes) override;
+	//! Memory-map the file for reading (not supported on Windows)
+	data_ptr_t MemoryMap(FileHandle &handle, idx_t nr_bytes) override;
+	void MemoryUnmap(FileHandle &handle, data_ptr_t pointer, idx_t nr_bytes) override;
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	//! Excise a range of the file. The file-system is free to deallocate this
@@ -256,7 +256,11 @@ public:
 			throw InternalException("parallel_lock is not held in TryOpenNextFile, this should not happen");
 		}
 
-		const auto file_lookahead_limit = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		auto file_lookahead_limit = ClientConfig::GetConfig(context).multi_file_open_lookahead;
+		if (file_lookahead_limit == 0) {
+			// by default we look (and open) ahead as far as there are threads
+			file_lookahead_limit = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		}
 
 		idx_t file_index = global_state.file_index;
 		idx_t i = 0;
@@ -415,6 +419,10 @@ public:
 					if (old_file_index != scan_data.file_index) {
 						InitializeFileScanState(context, current_reader_data, scan_data, gstate.projection_ids);
 					}
+					// pipelined file opening: while the other threads keep scanning, opportunistically
+					// open (i.e. read and parse the footer of) an upcoming file within the lookahead
+					// window, so nobody stalls on high-latency metadata reads at the next file boundary
+					TryOpenNextFile(context, bind_data, scan_data, gstate, parallel_lock);
 					return true;
 				} else {
 					// Set state to the next file
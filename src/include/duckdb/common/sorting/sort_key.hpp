@@ -258,6 +258,9 @@ public:
 	}
 
 	friend bool operator<(const SORT_KEY &lhs, const SORT_KEY &rhs) {
+		// note: only variable-length (string/blob) keys ever reach this prefix-then-heap comparison;
+		// fixed-width keys (including multi-column combinations of up to 32 bytes) are fully normalized
+		// into the inlined parts above and are compared radix-only, without any comparator fallback
 		auto comp_res = LessThan(&lhs.part0, &rhs.part0);
 		// If inlined is not equal, we can return already
 		if (comp_res != 0) {
@@ -178,12 +178,21 @@ public:
 private:
 	template <class T>
 	void InitializeChunk(const idx_t &chunk_idx) {
+		const bool is_forward_step = chunk_idx == current_chunk_idx + 1;
 		current_chunk_idx = chunk_idx;
 		if (keep_pinned) {
 			key_scan_state.pin_state.row_handles.acquire_handles(pins);
 			key_scan_state.pin_state.heap_handles.acquire_handles(pins);
 		}
 		key_data.FetchChunk(key_scan_state, 0, chunk_idx, false);
+		if (is_forward_step) {
+			// sequential (e.g. merge) access: advise the read of the next chunk's blocks, so offloaded
+			// runs are reloaded ahead of the merge cursor instead of stalling it
+			key_data.ReadAheadChunk(0, chunk_idx + 1);
+			if (pin_payload && payload_data) {
+				payload_data->ReadAheadChunk(0, chunk_idx + 1);
+			}
+		}
 		if (pin_payload && payload_data) {
 			if (keep_pinned) {
 				payload_scan_state.pin_state.row_handles.acquire_handles(pins);
@@ -60,6 +60,8 @@ public:
 
 	//! Get the buffer manager
 	BufferManager &GetBufferManager();
+	//! Collect the (row and heap) block handles referenced by the given chunk, e.g. for read-ahead
+	void GetChunkBlocks(const TupleDataChunk &chunk, vector<shared_ptr<BlockHandle>> &handles);
 	//! Get the buffer allocator
 	Allocator &GetAllocator();
 	//! Get the layout
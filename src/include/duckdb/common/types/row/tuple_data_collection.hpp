@@ -185,6 +185,8 @@ public:
 	                    TupleDataPinProperties properties = TupleDataPinProperties::UNPIN_AFTER_DONE) const;
 	//! Grab the chunk state for the given segment and chunk index, returns the count of the chunk
 	idx_t FetchChunk(TupleDataScanState &state, idx_t segment_idx, idx_t chunk_idx, bool init_heap);
+	//! Issue an advisory read-ahead for the blocks of the given chunk (best-effort)
+	void ReadAheadChunk(idx_t segment_idx, idx_t chunk_idx);
 	//! Scans a DataChunk from the TupleDataCollection
 	bool Scan(TupleDataScanState &state, DataChunk &result);
 	//! Scans a DataChunk from the TupleDataCollection
@@ -21,6 +21,8 @@ public:
 	DUCKDB_API explicit StringHeap(Allocator &allocator = Allocator::DefaultAllocator());
 
 	DUCKDB_API void Destroy();
+	//! Reset the heap for re-use: frees all but the first arena block, which is kept for the next strings
+	DUCKDB_API void Reset();
 	DUCKDB_API void Move(StringHeap &other);
 
 	//! Add a string to the string heap, returns a pointer to the string
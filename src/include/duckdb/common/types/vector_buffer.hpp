@@ -221,6 +221,14 @@ public:
 		references.push_back(std::move(heap));
 	}
 
+	//! Reset this buffer for re-use (only allowed when nothing else references it or its strings):
+	//! resets the heap, keeping its first arena block, and drops any referenced buffers
+	void Reset() {
+		heap.Reset();
+		references.clear();
+		SetAuxiliaryData(nullptr);
+	}
+
 private:
 	//! The string heap of this buffer
 	StringHeap heap;
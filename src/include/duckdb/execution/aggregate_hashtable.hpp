@@ -77,6 +77,7 @@ public:
 	optional_idx TryAddCompressedGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	optional_idx TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	optional_idx TryAddConstantGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
+	optional_idx TryAddClusteredGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Fetch the aggregates for specific groups from the HT and place them in the result
 	void FetchAggregates(DataChunk &groups, DataChunk &result);
@@ -169,6 +170,10 @@ private:
 	idx_t sink_count;
 	//! If true, we just append, skipping HT lookups
 	bool skip_lookups;
+	//! Whether to attempt run detection for clustered (locally sorted) group keys
+	bool detect_clustered_groups;
+	//! Chunks since the clustered-groups path was disabled, so we can periodically re-try it
+	uint8_t clustered_groups_retry_counter;
 	//! Whether to enable HLL counting the hashes
 	bool enable_hll;
 	//! The associated HLL
@@ -19,6 +19,7 @@
 #include "duckdb/parallel/pipeline.hpp"
 
 #include <condition_variable>
+#include <functional>
 
 namespace duckdb {
 class ClientContext;
@@ -58,6 +59,8 @@ public:
 	PendingExecutionResult ExecuteTask(bool dry_run = false);
 	void WaitForTask();
 	void SignalTaskRescheduled(lock_guard<mutex> &);
+	//! Invoke the notify callback (if any) - must be called without holding the executor lock
+	void NotifyCallback();
 
 	void Reset();
 
@@ -86,12 +89,15 @@ public:
 	//! Add the task to be rescheduled
 	void AddToBeRescheduled(shared_ptr<Task> &task);
 
+	//! Sets a callback that fires whenever a blocked task becomes schedulable again or a pipeline
+	//! completes. Meant for event-loop integration through PendingQueryResult: the callback may be
+	//! invoked from any scheduler thread and must not call back into DuckDB.
+	void SetNotifyCallback(std::function<void()> callback);
+
 	//! Returns the progress of the pipelines
 	idx_t GetPipelinesProgress(ProgressData &progress);
 
-	void CompletePipeline() {
-		completed_pipelines++;
-	}
+	void CompletePipeline();
 	ProducerToken &GetToken() {
 		return *producer;
 	}
@@ -186,6 +192,8 @@ private:
 	unordered_map<Task *, shared_ptr<Task>> to_be_rescheduled_tasks;
 	//! The semaphore to signal task rescheduling
 	std::condition_variable task_reschedule;
+	//! Callback fired (outside of the executor lock) when execution can make progress again
+	std::function<void()> notify_callback;
 
 	//! Currently alive executor tasks
 	atomic<idx_t> executor_tasks;
@@ -20,6 +20,11 @@ class ARTOperator {
 public:
 	//! Lookup returns a pointer to the leaf matching the key,
 	//! or nullptr, if no such leaf exists.
+	//! Descents are dependent loads - each level's address comes out of the previous node - so a
+	//! batched, interleaved variant (advance 32-64 keys one level per round, prefetching each key's
+	//! next node via the fixed-size allocator's address computation) is the known way to hide the
+	//! per-level miss. The callers that would use it pin probe order to input order for conflict
+	//! reporting (see VerifyAppend), so results must be buffered per batch and consumed in order.
 	static unsafe_optional_ptr<const Node> Lookup(ART &art, const Node &node, const ARTKey &key, idx_t depth) {
 		reference<const Node> ref(node);
 
@@ -79,6 +79,10 @@ public:
 
 public:
 	//! Obtains a lock on the index.
+	//! Note: this coarse lock serializes readers and writers by design. Optimistic lock coupling in the
+	//! ART would additionally require deferred (epoch-based) node reclamation - the FixedSizeAllocator
+	//! frees and re-uses node memory immediately, so version-validated readers could dereference freed
+	//! nodes. Both pieces would have to land together.
 	void InitializeLock(IndexLock &state);
 	//! Appends data to the locked index.
 	virtual ErrorData Append(IndexLock &l, DataChunk &chunk, Vector &row_ids) = 0;
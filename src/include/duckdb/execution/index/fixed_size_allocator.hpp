@@ -23,6 +23,11 @@ namespace duckdb {
 //! The FixedSizeAllocator provides pointers to fixed-size memory segments of pre-allocated memory buffers.
 //! The pointers are IndexPointers, and the leftmost byte (metadata) must always be zero.
 //! It is also possible to directly request a C++ pointer to the underlying segment of an index pointer.
+//! Note on scaling: the allocator itself is not what serializes concurrent index inserts - tree
+//! mutations synchronize above it - so per-thread free lists would not shorten the insert hot path
+//! until tree-level concurrency changes. The backing memory comes from buffer-managed blocks, whose
+//! page size is the system allocator's concern; transparent hugepages already cover these large
+//! allocations where the OS enables them.
 class FixedSizeAllocator {
 public:
 	//! We can vacuum 10% or more of the total in-memory footprint
@@ -23,7 +23,7 @@ public:
 public:
 	PhysicalPerfectHashAggregate(ClientContext &context, vector<LogicalType> types,
 	                             vector<unique_ptr<Expression>> aggregates, vector<unique_ptr<Expression>> groups,
-	                             const vector<unique_ptr<BaseStatistics>> &group_stats, vector<idx_t> required_bits,
+	                             const vector<unique_ptr<BaseStatistics>> &group_stats, vector<idx_t> group_ranges,
 	                             idx_t estimated_cardinality);
 
 	//! The groups
@@ -78,7 +78,7 @@ public:
 	//! The minimum value of each of the groups
 	vector<Value> group_minima;
 	//! The number of bits we need to completely cover each of the groups
-	vector<idx_t> required_bits;
+	vector<idx_t> group_ranges;
 
 	unordered_map<Expression *, size_t> filter_indexes;
 };
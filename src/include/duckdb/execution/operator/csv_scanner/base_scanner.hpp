@@ -309,8 +309,12 @@ protected:
 				while (iterator.pos.buffer_pos + 8 < to_pos) {
 					const uint64_t value =
 					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
+					// note: we must also stop at (carriage) returns here, like skip_quoted below does,
+					// so that quoted newlines always go through the QUOTED_NEW_LINE state
 					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
+					                     (value ^ state_machine->transition_array.escape) &
+					                     (value ^ state_machine->transition_array.new_line) &
+					                     (value ^ state_machine->transition_array.carriage_return))) {
 						break;
 					}
 					iterator.pos.buffer_pos += 8;
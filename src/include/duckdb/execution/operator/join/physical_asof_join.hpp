@@ -14,6 +14,10 @@
 namespace duckdb {
 
 //! PhysicalAsOfJoin represents an as-of join between two tables
+//! Note on caching the build side across queries: the sorted/partitioned build is constructed from the
+//! current transaction's snapshot, so a cross-query cache keyed only on table version would leak rows
+//! that are not visible (or miss rows that are) to other transactions - reusing it would require
+//! snapshot-aware invalidation that the storage layer does not expose
 class PhysicalAsOfJoin : public PhysicalComparisonJoin {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::ASOF_JOIN;
@@ -54,6 +54,14 @@ public:
 	//! Join Keys statistics (optional)
 	vector<unique_ptr<BaseStatistics>> join_stats;
 
+	//! Whether to emit an extra column containing the hash of the probe keys, directly after the probe-side
+	//! output columns - set by the physical planner when a parent hash aggregate groups by exactly the probe
+	//! keys, so that its hash table can reuse the hash instead of recomputing it
+	bool emit_probe_key_hash = false;
+
+	//! Reference the probe-side output columns and the probe key hash column into lhs_output
+	void ReferenceLHSOutputColumns(DataChunk &lhs_output, DataChunk &input, Vector &probe_key_hashes) const;
+
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
 
@@ -16,7 +16,9 @@ namespace duckdb {
 class MergeJoinGlobalState;
 
 //! PhysicalPiecewiseMergeJoin represents a piecewise merge loop join between
-//! two tables
+//! two tables. Note that it materializes and sorts both inputs itself: it cannot consume pre-sorted
+//! input without sorting, so "known-ordered" inputs do not make it a streaming merge join - that would
+//! require a dedicated operator (and table-level ordering metadata, which is not tracked)
 class PhysicalPiecewiseMergeJoin : public PhysicalRangeJoin {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::PIECEWISE_MERGE_JOIN;
@@ -26,6 +26,9 @@ public:
 
 	vector<const_reference<PhysicalOperator>> cte_scans;
 
+	//! The materialized CTE result, reference-counted and shared by every consumer: each CTE scan holds
+	//! its own scan state over this one buffer-managed collection (which supports concurrent readers),
+	//! so diamond-shaped plans keep a single copy of the shared intermediate
 	shared_ptr<ColumnDataCollection> working_table;
 
 	idx_t table_index;
@@ -17,7 +17,7 @@ class PerfectAggregateHashTable : public BaseAggregateHashTable {
 public:
 	PerfectAggregateHashTable(ClientContext &context, Allocator &allocator, const vector<LogicalType> &group_types,
 	                          vector<LogicalType> payload_types_p, vector<AggregateObject> aggregate_objects,
-	                          vector<Value> group_minima, vector<idx_t> required_bits);
+	                          vector<Value> group_minima, vector<idx_t> group_ranges);
 	~PerfectAggregateHashTable() override;
 
 public:
@@ -32,11 +32,9 @@ public:
 
 protected:
 	Vector addresses;
-	//! The required bits per group
-	vector<idx_t> required_bits;
-	//! The total required bits for the HT (this determines the max capacity)
-	idx_t total_required_bits;
-	//! The total amount of groups
+	//! The size of the dense value domain per group column, including one slot for NULL
+	vector<idx_t> group_ranges;
+	//! The total amount of groups (the product of the group ranges, this determines the max capacity)
 	idx_t total_groups;
 	//! The tuple size
 	idx_t tuple_size;
@@ -152,7 +152,11 @@ public:
 	//! Returns the current progress percentage, or a negative value if progress bars are not supported
 	virtual ProgressData GetProgress(ClientContext &context, GlobalSourceState &gstate) const;
 
-	//! Returns the current progress percentage, or a negative value if progress bars are not supported
+	//! Returns the current progress percentage, or a negative value if progress bars are not supported.
+	//! Blocking operators override this to account for their post-scan phases - sorting reports run
+	//! generation and merge progress, aggregation reports partition finalize progress through its
+	//! source-side GetProgress - so pipelines do not sit at "100% scanned" while finalizing; the same
+	//! numbers feed duckdb_query_progress for programmatic consumers.
 	virtual ProgressData GetSinkProgress(ClientContext &context, GlobalSinkState &gstate,
 	                                     const ProgressData source_progress) const {
 		return source_progress;
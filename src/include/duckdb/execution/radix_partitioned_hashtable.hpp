@@ -32,6 +32,9 @@ public:
 	vector<LogicalType> group_types;
 	//! The GROUPING values that belong to this hash table
 	vector<Value> grouping_values;
+	//! Optional index of a column in the sink input that holds precomputed group hashes - set by the
+	//! physical planner when the child operator (e.g. a hash join) already computed them
+	optional_idx precomputed_hash_column;
 
 public:
 	//! Sink Interface
@@ -59,6 +59,9 @@ struct WriteCSVData : public BaseCSVData {
 	idx_t flush_size = 4096ULL * 8ULL;
 	//! For each byte whether the CSV file requires quotes when containing the byte
 	unsafe_unique_array<bool> requires_quotes;
+	//! Per column: whether the rendered text can never require quoting (based on the characters the
+	//! column's type can produce), letting the writer skip the per-value quote scan
+	vector<bool> never_requires_quotes;
 	//! Expressions used to convert the input into strings
 	vector<unique_ptr<Expression>> cast_expressions;
 };
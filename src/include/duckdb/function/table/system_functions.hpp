@@ -107,6 +107,18 @@ struct DuckDBExternalFileCacheFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBObjectCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBQueryLogFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBMemoryDetailFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBOptimizersFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -394,6 +394,10 @@ public:
 	//! (Optional) If this scanner supports filter pushdown, but not to all data types
 	table_function_supports_pushdown_type_t supports_pushdown_type;
 	//! Get partition info of the table
+	//! Together with get_partition_data (batch/partition ordering) and get_partition_stats
+	//! (per-partition cardinalities) this is how table functions declare output partitioning so the
+	//! planner can skip repartitioning - the same hooks the internal table scan uses. These are not yet
+	//! part of the stable C table-function API; C-registered functions currently cannot declare them.
 	table_function_get_partition_info_t get_partition_info;
 	//! (Optional) get a list of all the partition stats of the table
 	table_function_get_partition_stats_t get_partition_stats;
@@ -17,6 +17,11 @@ class WindowCollection;
 class WindowCursor;
 struct WindowSharedExpressions;
 
+//! Note on sharing across co-framed aggregates: input expressions (partition, order, arguments) are
+//! already deduplicated between window functions through WindowSharedExpressions, but each aggregate
+//! keeps its own segment tree, because the tree nodes store that aggregate's states - evaluating N
+//! aggregates in one traversal would require a combined multi-aggregate state layout threaded through
+//! the tree build, combine and finalize paths
 class WindowAggregatorState {
 public:
 	WindowAggregatorState();
@@ -130,6 +130,10 @@ protected:
 
 // Non Thread-safe logger
 // - will cache log entries locally
+// This is the low-overhead production path: entries buffer per thread without touching the storage
+// lock and reach the shared in-memory ring (queryable through duckdb_logs()) only on flush, while
+// ShouldLog gates disabled levels before any message is even formatted - the callsite templates only
+// construct the string after the level check passes.
 class ThreadLocalLogger : public Logger {
 public:
 	explicit ThreadLocalLogger(LogConfig &config_p, LoggingContext &context_p, LogManager &manager);
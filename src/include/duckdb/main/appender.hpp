@@ -25,6 +25,16 @@ enum class AppenderType : uint8_t {
 	PHYSICAL // Cast input -> PhysicalType
 };
 
+//! A single column of a columnar append (see BaseAppender::AppendColumns): a caller-owned buffer of
+//! values in DuckDB's internal representation (e.g. int32_t for INTEGER, string_t for VARCHAR),
+//! with an optional validity bitmap
+struct AppenderColumn {
+	//! The column values
+	data_ptr_t data = nullptr;
+	//! Optional validity bitmap (one bit per value, 1 = valid); all values are valid if not set
+	validity_t *validity = nullptr;
+};
+
 //! The Appender class can be used to append elements to a table.
 class BaseAppender {
 public:
@@ -89,6 +99,10 @@ public:
 		return column;
 	}
 	DUCKDB_API void AppendDataChunk(DataChunk &value);
+	//! Appends `count` rows from caller-owned columnar buffers. The buffers are borrowed, not copied,
+	//! until the data is appended into the appender's collection - there are no per-value conversions.
+	//! Only types with a fixed-size internal representation and VARCHAR are supported.
+	DUCKDB_API void AppendColumns(const vector<AppenderColumn> &columns, idx_t count);
 
 	//! Appends a column to the active column list.
 	//! Immediately flushes all previous data.
@@ -74,6 +74,13 @@ struct ClientConfig {
 	bool enable_optimizer = true;
 	//! Enable caching operators
 	bool enable_caching_operators = true;
+	//! Adaptively size the row ranges handed out by parallel table scans based on runtime feedback
+	bool adaptive_morsel_scans = false;
+	//! Schedule this connection's query tasks at background priority - worker threads prefer tasks of
+	//! regular-priority connections and only pick these up when no regular work is available
+	bool scheduler_background_priority = false;
+	//! How many files multi-file scans keep opened (footer parsed) ahead of the scan (0 = number of threads)
+	idx_t multi_file_open_lookahead = 0;
 	//! Force parallelism of small tables, used for testing
 	bool verify_parallelism = false;
 	//! Force out-of-core computation for operators that support it, used for testing
@@ -98,6 +105,9 @@ struct ClientConfig {
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 	//! The amount of rows we can keep open before we close and flush them during a partitioned write
 	idx_t partitioned_write_max_open_files = idx_t(100);
+	//! The maximum number of join pairs the exact join order enumeration may emit before falling back to
+	//! the greedy heuristic (0 = always use the greedy heuristic)
+	idx_t join_order_pair_budget = 10000;
 	//! The number of rows we need on either table to choose a nested loop join
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
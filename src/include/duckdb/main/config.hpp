@@ -156,6 +156,9 @@ struct DBConfigOptions {
 	string autoinstall_extension_repo = "";
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
 	idx_t maximum_memory = DConstants::INVALID_INDEX;
+	//! The maximum working-set memory the memory-intensive operators of a single query may reserve
+	//! (DConstants::INVALID_INDEX = unlimited); lower values trigger earlier spilling
+	idx_t max_memory_per_query = DConstants::INVALID_INDEX;
 	//! The maximum size of the 'temp_directory' folder when set (in bytes). Default: 90% of available disk space.
 	idx_t maximum_swap_space = DConstants::INVALID_INDEX;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
@@ -272,6 +275,20 @@ struct DBConfigOptions {
 	idx_t default_block_header_size = DUCKDB_BLOCK_HEADER_STORAGE_SIZE;
 	//!  Whether or not to abort if a serialization exception is thrown during WAL playback (when reading truncated WAL)
 	bool abort_on_wal_failure = false;
+	//! Replay the data entries of the WAL in parallel (per table) on startup
+	bool parallel_wal_replay = false;
+	//! Run automatic checkpoints in a background task instead of blocking the committing transaction
+	bool background_checkpoint = false;
+	//! Spill evicted external file cache buffers to temporary files instead of dropping them
+	bool external_file_cache_spill = false;
+	//! Use a scan-resistant (two-queue) eviction policy for table data blocks (set before startup)
+	bool scan_resistant_eviction = false;
+	//! Memory-map read-only database files instead of issuing read system calls
+	bool mmap_database_files = false;
+	//! Directory used to persist the external file cache across restarts (empty = not persisted)
+	string external_file_cache_directory;
+	//! Maximum size (in bytes) of the object cache, e.g. for cached parquet metadata (0 = unlimited)
+	idx_t object_cache_size = 0;
 	//! The index_scan_percentage sets a threshold for index scans.
 	//! If fewer than MAX(index_scan_max_count, index_scan_percentage * total_row_count)
 	//! rows match, we perform an index scan instead of a table scan.
@@ -304,6 +321,8 @@ struct DBConfigOptions {
 #else
 	bool scheduler_process_partial = false;
 #endif
+	//! Partition task queues per NUMA node and pin worker threads to their node (Linux only, set before startup)
+	bool scheduler_numa_aware = false;
 
 	bool operator==(const DBConfigOptions &other) const;
 };
@@ -27,6 +27,7 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class QueryLog;
 struct AttachInfo;
 struct AttachOptions;
 class DatabaseFileSystem;
@@ -59,6 +60,7 @@ public:
 	DUCKDB_API ExternalFileCache &GetExternalFileCache();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API QueryLog &GetQueryLog();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API LogManager &GetLogManager() const;
@@ -93,6 +95,7 @@ private:
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<QueryLog> query_log;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_map<string, ExtensionInfo> loaded_extensions_info;
 	ValidChecker db_validity;
@@ -41,9 +41,18 @@ public:
 	shared_ptr<DuckDB> GetOrCreateInstance(const string &database, DBConfig &config_dict, bool cache_instance,
 	                                       const std::function<void(DuckDB &)> &on_create = nullptr);
 
+	//! Pre-creates an instance with the given configuration but without attached storage and adds it to
+	//! the warm pool. A later (Get)CreateInstance with a matching configuration takes the instance from
+	//! the pool and only pays the cost of attaching the database file.
+	void AddWarmInstance(DBConfig &config_dict);
+	//! The number of instances currently in the warm pool
+	idx_t WarmInstanceCount();
+
 private:
 	//! A map with the cached instances <absolute_path/instance>
 	unordered_map<string, weak_ptr<DatabaseCacheEntry>> db_instances;
+	//! Pre-created instances without attached storage
+	vector<shared_ptr<DuckDB>> warm_instances;
 
 	//! Lock to alter cache
 	mutex cache_lock;
@@ -52,5 +61,9 @@ private:
 	shared_ptr<DuckDB> GetInstanceInternal(const string &database, const DBConfig &config_dict);
 	shared_ptr<DuckDB> CreateInstanceInternal(const string &database, DBConfig &config_dict, bool cache_instance,
 	                                          const std::function<void(DuckDB &)> &on_create);
+	//! Takes a warm instance with a matching configuration from the pool (if any), attaching the
+	//! database file and making it the default database
+	shared_ptr<DuckDB> TryCheckoutWarmInstance(const string &instance_path, const DBConfig &config_dict,
+	                                           const shared_ptr<DatabaseCacheEntry> &cache_entry);
 };
 } // namespace duckdb
@@ -42,6 +42,11 @@ public:
 	//! The error message can be obtained by calling GetError() on the PendingQueryResult.
 	DUCKDB_API PendingExecutionResult ExecuteTask();
 	DUCKDB_API PendingExecutionResult CheckPulse();
+	//! Registers a callback that fires when execution can make progress again (a blocked task became
+	//! schedulable or a pipeline completed). Meant for event-loop integration: after ExecuteTask returns
+	//! BLOCKED or NO_TASKS_AVAILABLE, the callback signals when polling is worthwhile again. The
+	//! callback may fire from scheduler threads and must not call back into DuckDB.
+	DUCKDB_API void RegisterNotifyCallback(std::function<void()> callback);
 	//! Halt execution of the thread until a Task is ready to be executed (use with caution)
 	void WaitForTask();
 
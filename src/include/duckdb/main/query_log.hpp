@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_log.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! QueryLog is an always-on, fixed-size ring buffer of recently completed queries. Unlike the profiler
+//! it is cheap enough to stay enabled: it records one entry per query at negligible cost, so slow-query
+//! forensics on embedded instances can start from duckdb_query_log() after the fact.
+class QueryLog {
+public:
+	//! The number of queries the log retains
+	static constexpr idx_t QUERY_LOG_SIZE = 256;
+	//! Stored query strings are truncated to this many bytes to bound the log's memory
+	static constexpr idx_t MAX_QUERY_LENGTH = 16384;
+
+	struct Entry {
+		//! The query string
+		string query;
+		//! The time at which the query started
+		timestamp_t start_time;
+		//! How long the query ran, in milliseconds
+		double duration_ms;
+		//! Whether the query succeeded
+		bool success;
+	};
+
+public:
+	//! Add a completed query to the log
+	void Add(Entry entry);
+	//! Get the retained entries, ordered from oldest to newest
+	vector<Entry> GetEntries() const;
+
+private:
+	mutable mutex lock;
+	//! The ring buffer of entries
+	vector<Entry> entries = vector<Entry>(QUERY_LOG_SIZE);
+	//! The total number of queries added
+	idx_t total_count = 0;
+};
+
+} // namespace duckdb
@@ -71,6 +71,17 @@ struct AccessModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AdaptiveMorselScansSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "adaptive_morsel_scans";
+	static constexpr const char *Description =
+	    "Adaptively size the row ranges handed out by parallel table scans based on runtime feedback";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllocatorBackgroundThreadsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "allocator_background_threads";
@@ -273,6 +284,17 @@ struct AutoloadKnownExtensionsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Run automatic checkpoints in a background task instead of blocking the committing transaction";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CatalogErrorMaxSchemasSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "catalog_error_max_schemas";
@@ -694,6 +716,28 @@ struct ExtensionDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ExternalFileCacheDirectorySetting {
+	using RETURN_TYPE = string;
+	static constexpr const char *Name = "external_file_cache_directory";
+	static constexpr const char *Description =
+	    "Directory used to persist the external file cache across restarts (empty = not persisted)";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ExternalFileCacheSpillSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "external_file_cache_spill";
+	static constexpr const char *Description =
+	    "Spill evicted external file cache buffers to temporary files instead of dropping them";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ExternalThreadsSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "external_threads";
@@ -845,6 +889,18 @@ struct IntegerDivisionSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct JoinOrderPairBudgetSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "join_order_pair_budget";
+	static constexpr const char *Description =
+	    "The maximum number of join pairs the exact join order enumeration may emit before falling back to the greedy "
+	    "heuristic (0 = always use the greedy heuristic)";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct LambdaSyntaxSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "lambda_syntax";
@@ -940,6 +996,18 @@ struct MaxMemorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MaxMemoryPerQuerySetting {
+	using RETURN_TYPE = string;
+	static constexpr const char *Name = "max_memory_per_query";
+	static constexpr const char *Description =
+	    "The maximum working-set memory the memory-intensive operators of a single query may reserve (e.g. 1GB) - "
+	    "lower values trigger earlier spilling";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaxTempDirectorySizeSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "max_temp_directory_size";
@@ -971,6 +1039,28 @@ struct MergeJoinThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MmapDatabaseFilesSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "mmap_database_files";
+	static constexpr const char *Description =
+	    "Memory-map read-only database files instead of issuing read system calls (Unix only)";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct MultiFileOpenLookaheadSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "multi_file_open_lookahead";
+	static constexpr const char *Description =
+	    "How many files multi-file scans keep opened (footer parsed) ahead of the scan (0 = number of threads)";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct NestedLoopJoinThresholdSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "nested_loop_join_threshold";
@@ -982,6 +1072,17 @@ struct NestedLoopJoinThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ObjectCacheSizeSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "object_cache_size";
+	static constexpr const char *Description =
+	    "The maximum size (in bytes) of the object cache, e.g. for cached parquet metadata (0 = unlimited)";
+	static constexpr const char *InputType = "UBIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct OldImplicitCastingSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "old_implicit_casting";
@@ -1014,6 +1115,17 @@ struct OrderedAggregateThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ParallelWalReplaySetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "parallel_wal_replay";
+	static constexpr const char *Description =
+	    "Replay the data entries of the write-ahead log in parallel (per table) on startup";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct PartitionedWriteFlushThresholdSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "partitioned_write_flush_threshold";
@@ -1174,6 +1286,46 @@ struct ScalarSubqueryErrorOnMultipleRowsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ScanResistantEvictionSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "scan_resistant_eviction";
+	static constexpr const char *Description =
+	    "Use a scan-resistant (two-queue) eviction policy for table data blocks, protecting frequently used blocks "
+	    "from one-off scans (must be set before startup)";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static bool OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input);
+	static bool OnGlobalReset(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct SchedulerBackgroundPrioritySetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "scheduler_background_priority";
+	static constexpr const char *Description =
+	    "Schedule this connection's query tasks at background priority - worker threads prefer tasks of "
+	    "regular-priority connections";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct SchedulerNumaAwareSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "scheduler_numa_aware";
+	static constexpr const char *Description =
+	    "Partition task queues per NUMA node and pin worker threads to their node (Linux only, must be set before "
+	    "startup)";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static bool OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input);
+	static bool OnGlobalReset(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchedulerProcessPartialSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "scheduler_process_partial";
@@ -1258,6 +1410,20 @@ struct ThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct UseDirectIOSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "use_direct_io";
+	static constexpr const char *Description =
+	    "Use direct I/O (bypassing the operating system page cache) for database and temporary files (must be set "
+	    "before startup)";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static bool OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input);
+	static bool OnGlobalReset(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct UsernameSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "username";
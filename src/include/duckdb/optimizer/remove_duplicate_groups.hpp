@@ -14,23 +14,29 @@
 namespace duckdb {
 
 class BoundColumnRefExpression;
+class ClientContext;
 
 //! The RemoveDuplicateGroups optimizer traverses the logical operator tree and removes any duplicate aggregate groups
-//! Duplicate groups may be introduced when joins columns are removed, e.g., by Deliminator or RemoveUnusedColumns
+//! Duplicate groups may be introduced when joins columns are removed, e.g., by Deliminator or RemoveUnusedColumns.
+//! It also removes groups that are functionally dependent on other groups through a primary key,
+//! computing them as first() aggregates instead
 class RemoveDuplicateGroups : public LogicalOperatorVisitor {
 public:
-	RemoveDuplicateGroups() {
+	explicit RemoveDuplicateGroups(ClientContext &context) : context(context) {
 	}
 
 	void VisitOperator(LogicalOperator &op) override;
 
 private:
 	void VisitAggregate(LogicalAggregate &aggr);
+	void RemoveFunctionallyDependentGroups(LogicalAggregate &aggr);
 
 protected:
 	unique_ptr<Expression> VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) override;
 
 private:
+	//! The client context (used to bind the first() aggregates)
+	ClientContext &context;
 	//! The map of column references
 	column_binding_map_t<vector<reference<BoundColumnRefExpression>>> column_references;
 	//! Stored expressions (kept around so we don't have dangling pointers)
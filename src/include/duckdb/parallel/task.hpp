@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
@@ -22,6 +23,10 @@ enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
 enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR, TASK_BLOCKED };
 
+//! The scheduling priority class of a task - worker threads prefer REGULAR tasks and only pick up
+//! BACKGROUND tasks when no regular work is available
+enum class TaskPriority : uint8_t { REGULAR, BACKGROUND };
+
 //! Generic parallel task
 class Task : public enable_shared_from_this<Task> {
 public:
@@ -58,6 +63,11 @@ public:
 
 public:
 	optional_ptr<ProducerToken> token;
+	//! The NUMA node on which this task prefers to run - used to select a task queue when NUMA-aware
+	//! scheduling is enabled, so that e.g. sink partitions stay on the node that produced them
+	optional_idx numa_node;
+	//! The scheduling priority class of this task (set from scheduler_background_priority for query tasks)
+	TaskPriority priority = TaskPriority::REGULAR;
 };
 
 } // namespace duckdb
@@ -88,6 +88,11 @@ public:
 	//! Result do not need to be exact 'return 0' is a valid fallback strategy
 	static idx_t GetEstimatedCPUId();
 
+	//! Get the number of NUMA nodes in the system, 1 if NUMA information is unavailable
+	static idx_t NumaNodeCount();
+	//! Get the NUMA node on which the calling thread is currently executing, 0 if unavailable
+	static idx_t GetEstimatedNumaNode();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
 
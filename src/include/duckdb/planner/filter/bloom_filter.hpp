@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! BloomFilter is a compact, approximate membership filter over value hashes. It is pushed into probe-side
+//! scans by the hash join after the build side has been finalized, so that rows whose key hash cannot occur
+//! on the build side are eliminated at the scan. The filter can produce false positives - it can never prune
+//! based on statistics and must always be paired with the actual comparison (i.e. the join itself).
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	//! Create an empty bloom filter sized for the given expected number of values
+	explicit BloomFilter(idx_t expected_count);
+	//! Create a bloom filter from an existing block array (used when copying/deserializing)
+	explicit BloomFilter(vector<idx_t> blocks);
+
+	//! The filter bits, stored as a power-of-two number of 64-bit blocks
+	vector<idx_t> blocks;
+
+public:
+	//! Insert a value hash into the filter
+	void Insert(hash_t hash);
+	//! Check whether a value with the given hash may be in the filter
+	inline bool Find(hash_t hash) const {
+		const auto mask = GetBitMask(hash);
+		return (blocks[GetBlockIndex(hash)] & mask) == mask;
+	}
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	string ToString(const string &column_name) const override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The block is selected by the upper hash bits, the bits within the block by the lower hash bits,
+	//! so the probe bits stay (mostly) independent of the block selection
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		return (hash >> 32) & (blocks.size() - 1);
+	}
+	//! Two probe bits per value within a single 64-bit block
+	static inline idx_t GetBitMask(hash_t hash) {
+		return (idx_t(1) << (hash & 63)) | (idx_t(1) << ((hash >> 6) & 63));
+	}
+};
+
+} // namespace duckdb
@@ -33,7 +33,8 @@ enum class TableFilterType : uint8_t {
 	OPTIONAL_FILTER = 6,     // executing filter is not required for query correctness
 	IN_FILTER = 7,           // col IN (C1, C2, C3, ...)
 	DYNAMIC_FILTER = 8,      // dynamic filters can be updated at run-time
-	EXPRESSION_FILTER = 9    // an arbitrary expression
+	EXPRESSION_FILTER = 9,   // an arbitrary expression
+	BLOOM_FILTER = 10        // approximate membership filter over value hashes (false positives possible)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -24,6 +24,13 @@ struct ArenaChunk {
 	ArenaChunk *prev;
 };
 
+//! Bump-pointer arena with wholesale reset - this is the execution-side answer to per-operator
+//! temporary allocations: expression executor states, row-matching scratch, key generation and the
+//! like allocate from an arena owned by the state that needs them and free in one Reset/destruction.
+//! Bulk operator payloads (hash table heaps, sort runs) instead live in buffer-managed blocks that
+//! are likewise released wholesale. A single thread-local arena on the ExecutionContext would not
+//! work as a replacement: sink data outlives the pipeline that produced it, so the arena must be
+//! owned by the state with the matching lifetime, not by the thread.
 class ArenaAllocator {
 public:
 	static constexpr const idx_t ARENA_ALLOCATOR_INITIAL_CAPACITY = 2048;
@@ -60,6 +60,9 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Advise that the given block range will be read soon (best-effort, default is a no-op)
+	virtual void ReadAhead(block_id_t start_block, idx_t block_count) {
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -41,12 +41,26 @@ class BufferPool {
 	friend class StandardBufferManager;
 
 public:
-	BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, idx_t allocator_bulk_deallocation_flush_threshold);
+	BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, idx_t allocator_bulk_deallocation_flush_threshold,
+	           bool scan_resistant_eviction);
+
+	//! Statistics of a single eviction queue, exposed by duckdb_memory_detail()
+	struct EvictionQueueStats {
+		string buffer_types;
+		idx_t approximate_size = 0;
+		idx_t total_insertions = 0;
+		idx_t total_dead_nodes = 0;
+	};
+
+	//! Get statistics for each eviction queue
+	vector<EvictionQueueStats> GetEvictionQueueStats() const;
 	virtual ~BufferPool();
 
 	//! Set a new memory limit to the buffer pool, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
 	void SetLimit(idx_t limit, const char *exception_postscript);
+	//! Set the per-query working-set memory limit (DConstants::INVALID_INDEX = unlimited)
+	void SetQueryMemoryLimit(idx_t limit);
 
 	//! If bulk deallocation larger than this occurs, flush outstanding allocations
 	void SetAllocatorBulkDeallocationFlushThreshold(idx_t threshold);
@@ -95,6 +109,8 @@ protected:
 	static constexpr idx_t EVICTION_QUEUE_TYPES = FILE_BUFFER_TYPE_COUNT - 1;
 	//! How many eviction queues we have for the different FileBufferTypes
 	static constexpr idx_t BLOCK_AND_EXTERNAL_FILE_QUEUE_SIZE = 1;
+	//! With scan-resistant eviction, blocks get a second (protected) queue for re-accessed blocks
+	static constexpr idx_t SCAN_RESISTANT_BLOCK_QUEUE_SIZE = 2;
 	static constexpr idx_t MANAGED_BUFFER_QUEUE_SIZE = 6;
 	static constexpr idx_t TINY_BUFFER_QUEUE_SIZE = 1;
 	//! Mapping and priority order for the eviction queues
@@ -148,6 +164,8 @@ protected:
 	mutex limit_lock;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
 	atomic<idx_t> maximum_memory;
+	//! The per-query working-set memory limit (DConstants::INVALID_INDEX = unlimited)
+	atomic<idx_t> query_maximum_memory {DConstants::INVALID_INDEX};
 	//! If bulk deallocation larger than this occurs, flush outstanding allocations
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
@@ -99,6 +99,7 @@ public:
 	//! Set a new memory limit.
 	//! Throws an exception, if the new limit is too low, meaning not enough blocks can be evicted.
 	virtual void SetMemoryLimit(idx_t limit = (idx_t)-1);
+	virtual void SetQueryMemoryLimit(idx_t limit = (idx_t)-1);
 	//! Set a new swap limit.
 	virtual void SetSwapLimit(optional_idx limit = optional_idx());
 
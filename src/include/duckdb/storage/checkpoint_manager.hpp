@@ -122,6 +122,8 @@ public:
 
 private:
 	optional_ptr<ClientContext> client_context;
+	//! The blocks written by the table data writer (declared before the writer so it outlives it)
+	vector<MetaBlockPointer> table_metadata_pointers;
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
 	//! The table data writer is responsible for writing the DataPointers used by the table chunks
@@ -49,7 +49,13 @@ enum class DataTableVersion {
 	DROPPED     // this table has been dropped
 };
 
-//! DataTable represents a physical table on disk
+//! DataTable represents a physical table on disk.
+//! There is deliberately no declared partitioning at this level: per-row-group zone maps give
+//! time-series workloads the same pruning when inserts arrive roughly clustered on the time column
+//! (filter ranges from the FilterCombiner skip non-overlapping row groups without reading them), and
+//! the checkpoint-time vacuum keeps groups compact. What zone maps cannot provide is O(1) retention
+//! drops - truncating a key range as metadata requires partition-level catalog objects with their own
+//! row-group collections, a catalog and storage-format feature rather than a DataTable change.
 class DataTable : public enable_shared_from_this<DataTable> {
 public:
 	//! Constructs a new data table from an (optional) set of persistent segments
@@ -88,6 +88,7 @@ public:
 
 public:
 	ExternalFileCache(DatabaseInstance &db, bool enable);
+	~ExternalFileCache();
 
 public:
 	static ExternalFileCache &Get(DatabaseInstance &db);
@@ -95,6 +96,12 @@ public:
 
 	bool IsEnabled() const;
 	void SetEnabled(bool enable);
+	//! Whether evicted cache buffers spill to temporary files instead of being dropped
+	bool SpillEnabled() const;
+	//! Write the current cache contents to the configured cache directory (best-effort)
+	void SaveToDisk(const string &directory);
+	//! Warm up the cache from the configured cache directory (best-effort)
+	void LoadFromDisk(const string &directory);
 	vector<CachedFileInformation> GetCachedFileInformation() const;
 
 	BufferManager &GetBufferManager() const;
@@ -105,6 +112,8 @@ public:
 	                               const string &current_version_tag, time_t current_last_modified);
 
 private:
+	//! The database instance
+	DatabaseInstance &db;
 	//! The BufferManager used to cache files
 	BufferManager &buffer_manager;
 	//! Whether or not file caching is enabled
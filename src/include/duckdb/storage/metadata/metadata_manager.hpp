@@ -51,6 +51,8 @@ public:
 
 	MetadataHandle AllocateHandle();
 	MetadataHandle Pin(const MetadataPointer &pointer);
+	//! Advise the block manager that the given metadata block is about to be read
+	void ReadAhead(const MetaBlockPointer &pointer);
 
 	MetaBlockPointer GetDiskPointer(const MetadataPointer &pointer, uint32_t offset = 0);
 	MetadataPointer FromDiskPointer(MetaBlockPointer pointer);
@@ -30,6 +30,10 @@ public:
 	MetadataManager &GetManager() {
 		return manager;
 	}
+	//! The pointers of all blocks written by this writer (if tracked)
+	optional_ptr<vector<MetaBlockPointer>> GetWrittenPointers() {
+		return written_pointers;
+	}
 
 protected:
 	virtual MetadataHandle NextHandle();
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -24,17 +25,40 @@ public:
 	}
 
 	virtual string GetObjectType() = 0;
+	//! The approximate in-memory size of the cached object, used for capacity accounting - entries that
+	//! return 0 (the default) do not count towards the capacity
+	virtual idx_t GetObjectSize() {
+		return 0;
+	}
+};
+
+//! Statistics of the object cache
+struct ObjectCacheStats {
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+	idx_t current_size = 0;
+	idx_t capacity = 0;
 };
 
 class ObjectCache {
+	using object_cache_list_t = list<pair<string, shared_ptr<ObjectCacheEntry>>>;
+
 public:
+	explicit ObjectCache(DatabaseInstance &db) : db(db) {
+	}
+
 	shared_ptr<ObjectCacheEntry> GetObject(const string &key) {
 		lock_guard<mutex> glock(lock);
 		auto entry = cache.find(key);
 		if (entry == cache.end()) {
+			stats.misses++;
 			return nullptr;
 		}
-		return entry->second;
+		stats.hits++;
+		// move the entry to the front of the LRU list
+		lru.splice(lru.begin(), lru, entry->second);
+		return entry->second->second;
 	}
 
 	template <class T>
@@ -52,11 +76,14 @@ public:
 
 		auto entry = cache.find(key);
 		if (entry == cache.end()) {
+			stats.misses++;
 			auto value = make_shared_ptr<T>(args...);
-			cache[key] = value;
+			InsertEntry(key, value);
 			return value;
 		}
-		auto object = entry->second;
+		stats.hits++;
+		lru.splice(lru.begin(), lru, entry->second);
+		auto object = entry->second->second;
 		if (!object || object->GetObjectType() != T::ObjectType()) {
 			return nullptr;
 		}
@@ -65,19 +92,87 @@ public:
 
 	void Put(string key, shared_ptr<ObjectCacheEntry> value) {
 		lock_guard<mutex> glock(lock);
-		cache.insert(make_pair(std::move(key), std::move(value)));
+		auto entry = cache.find(key);
+		if (entry != cache.end()) {
+			EraseEntry(entry);
+		}
+		InsertEntry(key, std::move(value));
 	}
 
 	void Delete(const string &key) {
 		lock_guard<mutex> glock(lock);
-		cache.erase(key);
+		auto entry = cache.find(key);
+		if (entry == cache.end()) {
+			return;
+		}
+		EraseEntry(entry);
+	}
+
+	//! Get a snapshot of the entries in the cache (in LRU order, most recently used first)
+	vector<pair<string, shared_ptr<ObjectCacheEntry>>> GetEntries() {
+		lock_guard<mutex> glock(lock);
+		vector<pair<string, shared_ptr<ObjectCacheEntry>>> result;
+		for (auto &entry : lru) {
+			result.push_back(entry);
+		}
+		return result;
+	}
+
+	//! Get a snapshot of the cache statistics
+	ObjectCacheStats GetStats() {
+		lock_guard<mutex> glock(lock);
+		auto result = stats;
+		result.capacity = Capacity();
+		return result;
 	}
 
 	DUCKDB_API static ObjectCache &GetObjectCache(ClientContext &context);
 
 private:
-	//! Object Cache
-	unordered_map<string, shared_ptr<ObjectCacheEntry>> cache;
+	idx_t Capacity() const {
+		return DBConfig::GetConfig(db).options.object_cache_size;
+	}
+
+	void InsertEntry(const string &key, shared_ptr<ObjectCacheEntry> value) {
+		stats.current_size += value->GetObjectSize();
+		lru.emplace_front(key, std::move(value));
+		cache[key] = lru.begin();
+		EvictEntries();
+	}
+
+	void EraseEntry(unordered_map<string, object_cache_list_t::iterator>::iterator entry) {
+		stats.current_size -= entry->second->second->GetObjectSize();
+		lru.erase(entry->second);
+		cache.erase(entry);
+	}
+
+	void EvictEntries() {
+		const auto capacity = Capacity();
+		if (capacity == 0) {
+			// a capacity of 0 means the cache is unbounded
+			return;
+		}
+		// evict the least recently used entries until we are within the capacity again - we always keep
+		// the most recently used entry, even if it exceeds the capacity by itself
+		while (stats.current_size > capacity && lru.size() > 1) {
+			auto &evicted = lru.back();
+			stats.current_size -= evicted.second->GetObjectSize();
+			cache.erase(evicted.first);
+			lru.pop_back();
+			stats.evictions++;
+		}
+	}
+
+private:
+	//! The database instance (used to read the configured capacity)
+	DatabaseInstance &db;
+	//! Entries ordered from most to least recently used
+	object_cache_list_t lru;
+	//! Object Cache, pointing into the LRU list
+	unordered_map<string, object_cache_list_t::iterator> cache;
+	//! Cache statistics
+	ObjectCacheStats stats;
+	//! Lock over the entries and statistics
 	mutex lock;
 };
 
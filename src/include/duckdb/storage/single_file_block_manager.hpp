@@ -46,6 +46,7 @@ class SingleFileBlockManager : public BlockManager {
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db_p, const string &path_p, const StorageManagerOptions &options_p);
+	~SingleFileBlockManager() override;
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	//! Creates a new database.
@@ -57,6 +58,10 @@ public:
 	//! Creates a new Block using the specified block_id and returns a pointer
 	unique_ptr<Block> ConvertBlock(block_id_t block_id, FileBuffer &source_buffer) override;
 	unique_ptr<Block> CreateBlock(block_id_t block_id, FileBuffer *source_buffer) override;
+	//! Whether the database file is served through a memory map (read-only databases only)
+	bool IsMemoryMapped() const {
+		return mapped_data != nullptr;
+	}
 	//! Return the next free block id
 	block_id_t GetFreeBlockId() override;
 	//! Check the next free block id - but do not assign or allocate it
@@ -77,6 +82,7 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	void ReadAhead(block_id_t start_block, idx_t block_count) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -129,6 +135,10 @@ private:
 	string path;
 	//! The file handle
 	unique_ptr<FileHandle> handle;
+	//! Memory map of the (read-only) database file, if set up - see the mmap_database_files setting
+	data_ptr_t mapped_data = nullptr;
+	//! The size of the memory map
+	idx_t mapped_size = 0;
 	//! The buffer used to read/write to the headers
 	FileBuffer header_buffer;
 	//! The list of free blocks that can be written to currently
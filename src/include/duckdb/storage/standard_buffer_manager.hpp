@@ -81,6 +81,7 @@ public:
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
 	void SetMemoryLimit(idx_t limit = (idx_t)-1) final;
+	void SetQueryMemoryLimit(idx_t limit = (idx_t)-1) final;
 	void SetSwapLimit(optional_idx limit = optional_idx()) final;
 
 	//! Returns information about memory usage
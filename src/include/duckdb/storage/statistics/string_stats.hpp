@@ -22,6 +22,11 @@ struct SelectionVector;
 class Vector;
 
 struct StringStatsData {
+	//! The fixed min/max prefix width. Prefix-heavy domains (URLs) often agree on the first 8 bytes,
+	//! making these zone maps useless for them, but the width is baked into the statistics
+	//! serialization as fixed-size arrays: adaptive per-segment prefix lengths or additional n-gram
+	//! summaries for LIKE pruning are storage-format additions, to be introduced with a format version
+	//! bump rather than by changing this constant (which would corrupt existing databases)
 	constexpr static uint32_t MAX_STRING_MINMAX_SIZE = 8;
 
 	//! The minimum value of the segment, potentially truncated
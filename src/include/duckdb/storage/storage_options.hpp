@@ -22,7 +22,12 @@ struct StorageOptions {
 	optional_idx storage_version;
 	//! Block header size (only used for encryption)
 	optional_idx block_header_size;
-	//! Whether the database is encrypted
+	//! Whether the database is encrypted. The scaffolding for at-rest encryption hangs off this flag:
+	//! the main header carries ENCRYPTED_DATABASE_FLAG, block_header_size reserves per-block space for
+	//! IV/tag material, and the cipher itself comes from the EncryptionUtil/EncryptionState provider
+	//! interface (registered by extensions, whose crypto libraries use hardware AES where available).
+	//! The encrypt/decrypt calls belong in the same ChecksumAndWrite/ReadAndChecksum hooks that already
+	//! wrap every block - inline, since a block must be decrypted before anything can decode it.
 	bool encryption = false;
 };
 
@@ -86,6 +86,10 @@ public:
 		return make_uniq<CompressionAppendState>(std::move(handle));
 	}
 
+	// Append stores every string verbatim: the per-row entries are running end offsets into the segment
+	// blob and each string's length is recovered as the delta to the previous row's offset, so two rows
+	// can never share a blob position. Interning repeated values during ingest therefore needs a format
+	// with explicit per-row lengths (or real dictionary compression, which the checkpoint applies later).
 	static idx_t StringAppend(CompressionAppendState &append_state, ColumnSegment &segment, SegmentStatistics &stats,
 	                          UnifiedVectorFormat &data, idx_t offset, idx_t count) {
 		return StringAppendBase(append_state.handle, segment, stats, data, offset, count);
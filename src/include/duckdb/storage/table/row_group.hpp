@@ -146,6 +146,9 @@ public:
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
+	//! Whether the row group is fully persistent and unchanged since the last checkpoint, meaning its
+	//! column metadata can be re-used instead of rewritten
+	bool CanCheckpointIncrementally();
 	bool IsPersistent() const;
 	PersistentRowGroupData SerializeRowGroupInfo() const;
 
@@ -201,12 +204,22 @@ private:
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 
 	vector<MetaBlockPointer> CheckpointDeletes(MetadataManager &manager);
+	RowGroupPointer CheckpointIncremental(RowGroupWriter &writer, TableStatistics &global_stats);
 
 	bool HasUnloadedDeletes() const;
 
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
+	//! All metadata blocks spanned by this row group's serialized column metadata - the metadata writer
+	//! chains serialized columns across segments, so the heads in column_pointers alone do not cover
+	//! the chain. Collected when columns are lazily loaded or when a checkpoint writes the metadata;
+	//! incremental checkpoints must keep every one of these blocks alive
+	vector<MetaBlockPointer> column_metadata_blocks;
+	//! For how many columns column_metadata_blocks covers the full metadata chain
+	idx_t known_column_metadata_chains = 0;
+	//! Whether the row group was moved to a different row start since it was loaded
+	bool was_moved = false;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
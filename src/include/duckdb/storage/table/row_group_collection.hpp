@@ -57,6 +57,8 @@ public:
 	void AppendRowGroup(SegmentLock &l, idx_t start_row);
 	//! Get the nth row-group, negative numbers start from the back (so -1 is the last row group, etc)
 	RowGroup *GetRowGroup(int64_t index);
+	//! Get the row group following the given row group, or nullptr if it is the last one
+	optional_ptr<RowGroup> GetNextRowGroup(RowGroup &row_group);
 	void Verify();
 
 	void InitializeScan(CollectionScanState &state, const vector<StorageIndex> &column_ids,
@@ -19,6 +19,12 @@ struct DeleteInfo;
 class MetadataManager;
 struct MetaBlockPointer;
 
+//! Tracks row-level visibility (inserts/deletes) for one row group. Row groups without any
+//! transactional changes have no version manager at all, so scans of clean data already skip these
+//! checks entirely - a dedicated "checkpoint snapshot" connection mode would not remove any work
+//! there. Where changes do exist, the version manager and the update segments are the only record of
+//! them: base data is modified in place at checkpoint time, so there is no stable checkpoint image
+//! that could be served while skipping version checks without a block-level snapshot underneath.
 class RowVersionManager {
 public:
 	explicit RowVersionManager(idx_t start) noexcept;
@@ -196,6 +196,9 @@ public:
 	idx_t max_row;
 	//! The current batch index
 	idx_t batch_index;
+	//! The time at which the current morsel was handed to this scan state, used for adaptive morsel
+	//! scans (0 if no morsel has been handed out yet)
+	int64_t morsel_start_time_ns;
 	//! The valid selection
 	SelectionVector valid_sel;
 
@@ -279,6 +282,8 @@ struct ParallelCollectionScanState {
 	idx_t vector_index;
 	idx_t max_row;
 	idx_t batch_index;
+	//! The current morsel size (in vectors) handed out by adaptive morsel scans
+	idx_t morsel_vectors;
 	atomic<idx_t> processed_rows;
 	mutex lock;
 };
@@ -69,7 +69,10 @@ private:
 	shared_ptr<mutex> stats_lock;
 	//! Column statistics
 	vector<shared_ptr<ColumnStatistics>> column_stats;
-	//! The table sample
+	//! The table sample. Maintained incrementally on append and persisted with the table statistics,
+	//! this reservoir is the natural source for value-distribution estimates (histograms / common
+	//! values): derived summaries would have to be rebuilt on every mutation anyway, whereas the
+	//! sample is already kept current, so estimators should compute from it at optimization time.
 	unique_ptr<BlockingSample> table_sample;
 };
 
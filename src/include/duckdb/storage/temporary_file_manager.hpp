@@ -135,6 +135,8 @@ public:
 	//! Read/Write temporary buffers at given positions in this file (potentially compressed)
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer) const;
 	void WriteTemporaryBuffer(FileBuffer &buffer, idx_t block_index, AllocatedData &compressed_buffer) const;
+	//! Advise the file system that the given block will be read soon (best-effort)
+	void ReadAheadBuffer(idx_t block_index) const;
 
 	//! Deletes the file if there are no more blocks
 	bool DeleteIfEmpty();
@@ -194,6 +196,11 @@ private:
 //===--------------------------------------------------------------------===//
 // TemporaryFileCompressionLevel/TemporaryFileCompressionAdaptivity
 //===--------------------------------------------------------------------===//
+// Temporary buffers are compressed in-flight with ZSTD at the (fast, negative) levels below; the
+// adaptivity class continuously picks between them and uncompressed based on measured write times,
+// so spill-heavy workloads trade CPU for disk bandwidth only when that actually pays off. Type-aware
+// codecs (bitpacking, FSST) are not an option at this layer: by the time a buffer reaches the
+// temporary file manager it is an opaque block - the column layout is gone.
 enum class TemporaryCompressionLevel : int {
 	ZSTD_MINUS_FIVE = -5,
 	ZSTD_MINUS_THREE = -3,
@@ -274,6 +281,8 @@ public:
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
+	//! Advise the file system that the given offloaded block will be read soon (best-effort)
+	void ReadAheadBuffer(block_id_t id);
 	void DeleteTemporaryBuffer(block_id_t id);
 
 	//! Get the list of temporary files and their sizes
@@ -30,6 +30,8 @@ struct DuckCleanupInfo {
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
+struct ProducerToken;
+
 class DuckTransactionManager : public TransactionManager {
 public:
 	explicit DuckTransactionManager(AttachedDatabase &db);
@@ -38,6 +40,11 @@ public:
 public:
 	static DuckTransactionManager &Get(AttachedDatabase &db);
 
+	//! Schedule a background checkpoint task for this database (if none is scheduled yet)
+	void ScheduleBackgroundCheckpoint();
+	//! Executed by the background checkpoint task: clears the scheduled flag and checkpoints
+	void ExecuteBackgroundCheckpoint(ClientContext &context);
+
 	//! Start a new transaction
 	Transaction &StartTransaction(ClientContext &context) override;
 	//! Commit the given transaction
@@ -121,6 +128,12 @@ private:
 	mutex wal_lock;
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
+	//! Whether a background checkpoint task is currently scheduled
+	atomic<bool> background_checkpoint_scheduled = {false};
+	//! Lock protecting the creation of the background checkpoint producer token
+	mutex background_checkpoint_lock;
+	//! Producer token used to schedule background checkpoint tasks
+	unique_ptr<ProducerToken> background_checkpoint_producer;
 	idx_t last_committed_version = 0;
 
 	//! Only one cleanup can be active at any time.
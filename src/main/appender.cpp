@@ -455,6 +455,52 @@ void BaseAppender::AppendDataChunk(DataChunk &chunk_p) {
 	}
 }
 
+void BaseAppender::AppendColumns(const vector<AppenderColumn> &columns, idx_t count) {
+	auto &appender_types = GetActiveTypes();
+	if (columns.size() != appender_types.size()) {
+		throw InvalidInputException("incorrect column count in AppendColumns, expected %d, got %d",
+		                            appender_types.size(), columns.size());
+	}
+	for (idx_t i = 0; i < columns.size(); i++) {
+		auto physical_type = appender_types[i].InternalType();
+		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
+			throw InvalidInputException("unsupported type for AppendColumns, cannot borrow a flat buffer of type %s",
+			                            appender_types[i].ToString());
+		}
+		if (!columns[i].data) {
+			throw InvalidInputException("missing data buffer for AppendColumns column %d", i);
+		}
+	}
+
+	// append in vector-sized slices - the vectors borrow the caller's buffers, so the only copy that
+	// happens is the append into the column data collection itself
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		auto size = MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE);
+		DataChunk borrowed_chunk;
+		for (idx_t i = 0; i < columns.size(); i++) {
+			auto type_size = GetTypeIdSize(appender_types[i].InternalType());
+			Vector borrowed_vector(appender_types[i], columns[i].data + offset * type_size);
+			if (columns[i].validity) {
+				if (offset % ValidityMask::BITS_PER_VALUE == 0) {
+					// the slice starts on a validity word boundary - borrow the caller's bitmap directly
+					ValidityMask borrowed_validity(columns[i].validity + offset / ValidityMask::BITS_PER_VALUE, size);
+					FlatVector::SetValidity(borrowed_vector, borrowed_validity);
+				} else {
+					// unaligned slice (vector sizes below the word size) - shift the bits into place
+					ValidityMask caller_validity(columns[i].validity, count);
+					FlatVector::Validity(borrowed_vector).Slice(caller_validity, offset, size);
+				}
+			}
+			borrowed_chunk.data.emplace_back(std::move(borrowed_vector));
+		}
+		borrowed_chunk.SetCardinality(size);
+		collection->Append(borrowed_chunk);
+		if (collection->Count() >= flush_count) {
+			Flush();
+		}
+	}
+}
+
 void BaseAppender::FlushChunk() {
 	if (chunk.size() == 0) {
 		return;
@@ -7,6 +7,11 @@ namespace duckdb {
 BufferedData::BufferedData(Type type, weak_ptr<ClientContext> context_p) : type(type), context(std::move(context_p)) {
 	auto client_context = context.lock();
 	auto &config = ClientConfig::GetConfig(*client_context);
+	// the per-query buffering budget: set streaming_buffer_size on the connection before running the
+	// query. Backpressure is pipelined - when the buffer is full, the result sink parks itself through
+	// the InterruptState (BlockSink) and the scheduler runs no further tasks for it until the consumer
+	// drains chunks and UnblockSinks resumes it; only the final pipeline blocks, upstream operators
+	// have already finished into their materialized state by the time the result streams.
 	total_buffer_size = config.streaming_buffer_size;
 }
 
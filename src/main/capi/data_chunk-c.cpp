@@ -100,6 +100,10 @@ duckdb_logical_type duckdb_vector_get_column_type(duckdb_vector vector) {
 	return reinterpret_cast<duckdb_logical_type>(new duckdb::LogicalType(v->GetType()));
 }
 
+// This is the zero-copy batch interface for bindings: duckdb_data_chunk_get_vector plus the accessors
+// below hand out the raw typed data pointer, the validity bitmap, and (for VARCHAR) duckdb_string_t
+// entries whose blobs live in the vector's string heap - all with a lifetime tied to the data chunk,
+// so result consumers never need the per-value duckdb_value_* calls.
 void *duckdb_vector_get_data(duckdb_vector vector) {
 	if (!vector) {
 		return nullptr;
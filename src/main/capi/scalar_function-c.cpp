@@ -1,6 +1,7 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/type_visitor.hpp"
 #include "duckdb/common/types.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/function.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/main/capi/capi_internal.hpp"
@@ -290,6 +291,33 @@ void duckdb_scalar_function_set_bind(duckdb_scalar_function scalar_function, duc
 	info.bind = bind;
 }
 
+idx_t duckdb_scalar_function_bind_get_argument_count(duckdb_bind_info info) {
+	if (!info) {
+		return 0;
+	}
+	auto &bind_info = GetCScalarFunctionBindInfo(info);
+	return bind_info.arguments.size();
+}
+
+duckdb_value duckdb_scalar_function_bind_get_constant_argument(duckdb_bind_info info, idx_t index) {
+	if (!info) {
+		return nullptr;
+	}
+	auto &bind_info = GetCScalarFunctionBindInfo(info);
+	if (index >= bind_info.arguments.size()) {
+		return nullptr;
+	}
+	auto &argument = *bind_info.arguments[index];
+	if (!argument.IsFoldable()) {
+		return nullptr;
+	}
+	duckdb::Value result;
+	if (!duckdb::ExpressionExecutor::TryEvaluateScalar(bind_info.context, argument, result)) {
+		return nullptr;
+	}
+	return reinterpret_cast<duckdb_value>(new duckdb::Value(std::move(result)));
+}
+
 void duckdb_scalar_function_set_bind_data(duckdb_bind_info info, void *bind_data, duckdb_delete_callback_t destroy) {
 	if (!info) {
 		return;
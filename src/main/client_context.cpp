@@ -1,4 +1,6 @@
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_log.hpp"
+#include "duckdb/common/chrono.hpp"
 
 #include "duckdb/catalog/catalog_entry/scalar_function_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
@@ -47,10 +49,22 @@
 
 namespace duckdb {
 
+// Note on an in-engine cross-query result cache: keying on plan hash plus "table versions" is not sound
+// here - data tables have no monotonically published version covering in-flight transaction visibility,
+// so two transactions with different snapshots of the same table would collide on one cache entry, and
+// plans can embed non-deterministic functions, settings and variables that the key would have to capture.
+// Until the storage layer exposes snapshot-aware data versions, result caching has to stay outside the
+// engine, where the caller controls the consistency contract.
+
 struct ActiveQueryContext {
 public:
 	//! The query that is currently being executed
 	string query;
+	//! When the query started (for the query log)
+	timestamp_t start_time = Timestamp::GetCurrentTimestamp();
+	//! Steady-clock start of the query, in nanoseconds (for the query log)
+	int64_t start_time_ns =
+	    duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
 	//! The query executor
@@ -229,6 +243,16 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	}
 	active_query->progress_bar.reset();
 	D_ASSERT(active_query.get());
+	{
+		// record the query in the always-on query log
+		QueryLog::Entry log_entry;
+		log_entry.query = active_query->query;
+		log_entry.start_time = active_query->start_time;
+		const auto now_ns = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+		log_entry.duration_ms = static_cast<double>(now_ns - active_query->start_time_ns) / 1000000.0;
+		log_entry.success = success;
+		db->GetQueryLog().Add(std::move(log_entry));
+	}
 	active_query.reset();
 	query_progress.Initialize();
 	ErrorData error;
@@ -59,6 +59,7 @@ bool DBConfigOptions::debug_print_bindings = false;
 
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
+    DUCKDB_LOCAL(AdaptiveMorselScansSetting),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
     DUCKDB_GLOBAL(AllocatorBulkDeallocationFlushThresholdSetting),
     DUCKDB_GLOBAL(AllocatorFlushThresholdSetting),
@@ -77,6 +78,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoinstallExtensionRepositorySetting),
     DUCKDB_GLOBAL(AutoinstallKnownExtensionsSetting),
     DUCKDB_GLOBAL(AutoloadKnownExtensionsSetting),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
     DUCKDB_GLOBAL(CatalogErrorMaxSchemasSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
@@ -119,6 +121,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(ErrorsAsJSONSetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
+    DUCKDB_GLOBAL(ExternalFileCacheDirectorySetting),
+    DUCKDB_GLOBAL(ExternalFileCacheSpillSetting),
     DUCKDB_GLOBAL(ExternalThreadsSetting),
     DUCKDB_LOCAL(FileSearchPathSetting),
     DUCKDB_GLOBAL(ForceBitpackingModeSetting),
@@ -133,6 +137,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(IndexScanMaxCountSetting),
     DUCKDB_GLOBAL(IndexScanPercentageSetting),
     DUCKDB_LOCAL(IntegerDivisionSetting),
+    DUCKDB_LOCAL(JoinOrderPairBudgetSetting),
     DUCKDB_LOCAL(LambdaSyntaxSetting),
     DUCKDB_LOCAL(LateMaterializationMaxRowsSetting),
     DUCKDB_GLOBAL(LockConfigurationSetting),
@@ -143,13 +148,18 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(MaxExpressionDepthSetting),
     DUCKDB_GLOBAL(MaxMemorySetting),
     DUCKDB_GLOBAL_ALIAS("memory_limit", MaxMemorySetting),
+    DUCKDB_GLOBAL(MaxMemoryPerQuerySetting),
     DUCKDB_GLOBAL(MaxTempDirectorySizeSetting),
     DUCKDB_GLOBAL(MaxVacuumTasksSetting),
     DUCKDB_LOCAL(MergeJoinThresholdSetting),
+    DUCKDB_GLOBAL(MmapDatabaseFilesSetting),
+    DUCKDB_LOCAL(MultiFileOpenLookaheadSetting),
     DUCKDB_LOCAL(NestedLoopJoinThresholdSetting),
+    DUCKDB_GLOBAL(ObjectCacheSizeSetting),
     DUCKDB_GLOBAL(OldImplicitCastingSetting),
     DUCKDB_LOCAL(OrderByNonIntegerLiteralSetting),
     DUCKDB_LOCAL(OrderedAggregateThresholdSetting),
+    DUCKDB_GLOBAL(ParallelWalReplaySetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThresholdSetting),
     DUCKDB_LOCAL(PartitionedWriteMaxOpenFilesSetting),
     DUCKDB_GLOBAL(PasswordSetting),
@@ -166,6 +176,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(ProfilingModeSetting),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
     DUCKDB_LOCAL(ScalarSubqueryErrorOnMultipleRowsSetting),
+    DUCKDB_GLOBAL(ScanResistantEvictionSetting),
+    DUCKDB_LOCAL(SchedulerBackgroundPrioritySetting),
+    DUCKDB_GLOBAL(SchedulerNumaAwareSetting),
     DUCKDB_GLOBAL(SchedulerProcessPartialSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
@@ -175,6 +188,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(TempDirectorySetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
+    DUCKDB_GLOBAL(UseDirectIOSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
     DUCKDB_GLOBAL(ZstdMinStringLengthSetting),
@@ -1,5 +1,7 @@
 #include "duckdb/main/database.hpp"
 
+#include "duckdb/main/query_log.hpp"
+
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/virtual_file_system.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
@@ -290,7 +292,8 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	external_file_cache = make_uniq<ExternalFileCache>(*this, config.options.enable_external_file_cache);
 
 	scheduler = make_uniq<TaskScheduler>(*this);
-	object_cache = make_uniq<ObjectCache>();
+	object_cache = make_uniq<ObjectCache>(*this);
+	query_log = make_uniq<QueryLog>();
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -376,6 +379,10 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryLog &DatabaseInstance::GetQueryLog() {
+	return *query_log;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -464,8 +471,10 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	} else {
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps,
-		                                                 config.options.allocator_bulk_deallocation_flush_threshold);
+		                                                 config.options.allocator_bulk_deallocation_flush_threshold,
+		                                                 config.options.scan_resistant_eviction);
 	}
+	config.buffer_pool->SetQueryMemoryLimit(config.options.max_memory_per_query);
 	config.db_cache_entry = std::move(new_config.db_cache_entry);
 }
 
@@ -125,6 +125,11 @@ optional_ptr<AttachedDatabase> DatabaseManager::GetDatabaseFromPath(ClientContex
 	return nullptr;
 }
 
+// The locks in this file guard only the attach/detach-time path registry - they are never taken on
+// the scan path. At execution time, attached databases are fully independent: each has its own block
+// manager, buffer-pool accounting, and file handle, and scan threads issue reads directly (there is
+// no central I/O dispatcher to be unfair), so a UNION across attached shards parallelizes across
+// files exactly as far as the OS I/O scheduler and the disks allow.
 void DatabaseManager::CheckPathConflict(ClientContext &context, const string &path) {
 	// ensure that we did not already attach a database with the same path
 	bool path_exists;
@@ -1,5 +1,9 @@
 #include "duckdb/main/db_instance_cache.hpp"
+
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 
 namespace duckdb {
 
@@ -99,7 +103,10 @@ shared_ptr<DuckDB> DBInstanceCache::CreateInstanceInternal(const string &databas
 		cache_entry = make_shared_ptr<DatabaseCacheEntry>();
 		config.db_cache_entry = cache_entry;
 	}
-	auto db_instance = make_shared_ptr<DuckDB>(instance_path, &config);
+	auto db_instance = TryCheckoutWarmInstance(instance_path, config, cache_entry);
+	if (!db_instance) {
+		db_instance = make_shared_ptr<DuckDB>(instance_path, &config);
+	}
 	if (cache_entry) {
 		// attach cache entry to the database
 		cache_entry->database = db_instance;
@@ -113,6 +120,58 @@ shared_ptr<DuckDB> DBInstanceCache::CreateInstanceInternal(const string &databas
 	return db_instance;
 }
 
+void DBInstanceCache::AddWarmInstance(DBConfig &config) {
+	// create the instance outside of the cache lock - this is the expensive part the warm pool hides
+	auto db_instance = make_shared_ptr<DuckDB>(IN_MEMORY_PATH, &config);
+	lock_guard<mutex> l(cache_lock);
+	warm_instances.push_back(std::move(db_instance));
+}
+
+idx_t DBInstanceCache::WarmInstanceCount() {
+	lock_guard<mutex> l(cache_lock);
+	return warm_instances.size();
+}
+
+shared_ptr<DuckDB> DBInstanceCache::TryCheckoutWarmInstance(const string &instance_path, const DBConfig &config,
+                                                            const shared_ptr<DatabaseCacheEntry> &cache_entry) {
+	if (!ExtensionHelper::ExtractExtensionPrefixFromPath(instance_path).empty()) {
+		// paths with an extension prefix go through a replacement open in the constructor - they cannot
+		// be attached to a warm instance
+		return nullptr;
+	}
+	shared_ptr<DuckDB> db_instance;
+	for (auto it = warm_instances.begin(); it != warm_instances.end(); it++) {
+		if ((*it)->instance->config == config) {
+			db_instance = *it;
+			warm_instances.erase(it);
+			break;
+		}
+	}
+	if (!db_instance) {
+		return nullptr;
+	}
+	if (instance_path != IN_MEMORY_PATH) {
+		// attach the database file and make it the default database of the instance
+		Connection con(*db_instance);
+		auto result = con.Query("ATTACH " + KeywordHelper::WriteQuoted(instance_path));
+		if (result->HasError()) {
+			// could not attach (e.g. the file is locked): return the instance to the pool
+			// the caller already holds the cache lock
+			warm_instances.push_back(db_instance);
+			result->ThrowError();
+		}
+		auto &fs = db_instance->instance->GetFileSystem();
+		auto db_name = AttachedDatabase::ExtractDatabaseName(instance_path, fs);
+		con.BeginTransaction();
+		db_instance->instance->GetDatabaseManager().SetDefaultDatabase(*con.context, db_name);
+		con.Commit();
+	}
+	if (cache_entry) {
+		db_instance->instance->config.db_cache_entry = cache_entry;
+	}
+	return db_instance;
+}
+
 shared_ptr<DuckDB> DBInstanceCache::CreateInstance(const string &database, DBConfig &config, bool cache_instance,
                                                    const std::function<void(DuckDB &)> &on_create) {
 	lock_guard<mutex> l(cache_lock);
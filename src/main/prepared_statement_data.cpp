@@ -8,6 +8,13 @@
 
 namespace duckdb {
 
+// Note on sharing prepared plans across connections: physical plans are not copyable - operators own
+// sink/operator state factories and hold references resolved against the creating context - so a shared
+// cache would have to store serialized optimized logical plans and re-run physical planning per use,
+// keyed on SQL text, catalog version and a full settings/variable fingerprint (many settings change
+// binding or optimization behavior). That is a plan-serialization feature of its own rather than a cache
+// bolt-on; per-connection prepared statements remain the supported way to amortize binding today.
+
 PreparedStatementData::PreparedStatementData(StatementType type) : statement_type(type) {
 }
 
@@ -39,6 +46,11 @@ bool CheckCatalogIdentity(ClientContext &context, const string &catalog_name,
 	return StatementProperties::CatalogIdentity {current_catalog_oid, current_catalog_version} == catalog_identity;
 }
 
+// This catalog-version check is what makes prepared statements the plan cache for recurring jobs:
+// a prepared plan (including its physical plan) is reused as-is while the catalog identities of every
+// read and modified database still match, and only a mismatch forces the parse/bind/optimize path
+// again. An out-of-process store of serialized plans would sit on the same invariant, but would also
+// have to fingerprint every setting that influences planning - in-process reuse gets that for free.
 bool PreparedStatementData::RequireRebind(ClientContext &context,
                                           optional_ptr<case_insensitive_map_t<BoundParameterData>> values) {
 	idx_t count = values ? values->size() : 0;
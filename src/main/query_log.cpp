@@ -0,0 +1,31 @@
+#include "duckdb/main/query_log.hpp"
+
+namespace duckdb {
+
+void QueryLog::Add(Entry entry) {
+	if (entry.query.size() > MAX_QUERY_LENGTH) {
+		// truncate on a UTF-8 codepoint boundary - cutting a multi-byte codepoint in half would make
+		// duckdb_query_log() emit invalid UTF-8
+		idx_t truncate_at = MAX_QUERY_LENGTH;
+		while (truncate_at > 0 && (static_cast<unsigned char>(entry.query[truncate_at]) & 0xC0) == 0x80) {
+			truncate_at--;
+		}
+		entry.query.resize(truncate_at);
+	}
+	lock_guard<mutex> guard(lock);
+	entries[total_count % QUERY_LOG_SIZE] = std::move(entry);
+	total_count++;
+}
+
+vector<QueryLog::Entry> QueryLog::GetEntries() const {
+	lock_guard<mutex> guard(lock);
+	vector<Entry> result;
+	const auto count = MinValue<idx_t>(total_count, QUERY_LOG_SIZE);
+	result.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		result.push_back(entries[(total_count - count + i) % QUERY_LOG_SIZE]);
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -24,6 +24,14 @@ using namespace duckdb_yyjson; // NOLINT
 
 namespace duckdb {
 
+// Note on per-operator buffer-manager/spill attribution and flamechart export: pins and temporary-file
+// writes happen deep below the operators (buffer pool, tuple data allocators, shared caches), with no
+// operator identity on those paths - attributing bytes per operator would mean threading the profiler
+// through every pin/unpin and temp write, including ones issued by shared infrastructure on behalf of
+// several operators at once. The supported correlation points today are the per-operator timings and
+// cardinalities here, the metrics exposed through custom_profiling_settings, and the system-wide
+// temporary-file and memory introspection functions (duckdb_temporary_files(), duckdb_memory()).
+
 QueryProfiler::QueryProfiler(ClientContext &context_p)
     : context(context_p), running(false), query_requires_profiling(false), is_explain_analyze(false) {
 }
@@ -34,6 +34,22 @@ Value AccessModeSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.access_mode)));
 }
 
+//===----------------------------------------------------------------------===//
+// Adaptive Morsel Scans
+//===----------------------------------------------------------------------===//
+void AdaptiveMorselScansSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).adaptive_morsel_scans = input.GetValue<bool>();
+}
+
+void AdaptiveMorselScansSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).adaptive_morsel_scans = ClientConfig().adaptive_morsel_scans;
+}
+
+Value AdaptiveMorselScansSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.adaptive_morsel_scans);
+}
+
 //===----------------------------------------------------------------------===//
 // Allocator Background Threads
 //===----------------------------------------------------------------------===//
@@ -249,6 +265,22 @@ Value AutoloadKnownExtensionsSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.autoload_known_extensions);
 }
 
+//===----------------------------------------------------------------------===//
+// Background Checkpoint
+//===----------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===----------------------------------------------------------------------===//
 // Catalog Error Max Schemas
 //===----------------------------------------------------------------------===//
@@ -644,6 +676,38 @@ Value ExtensionDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(config.options.extension_directory);
 }
 
+//===----------------------------------------------------------------------===//
+// External File Cache Directory
+//===----------------------------------------------------------------------===//
+void ExternalFileCacheDirectorySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.external_file_cache_directory = input.GetValue<string>();
+}
+
+void ExternalFileCacheDirectorySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.external_file_cache_directory = DBConfig().options.external_file_cache_directory;
+}
+
+Value ExternalFileCacheDirectorySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.external_file_cache_directory);
+}
+
+//===----------------------------------------------------------------------===//
+// External File Cache Spill
+//===----------------------------------------------------------------------===//
+void ExternalFileCacheSpillSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.external_file_cache_spill = input.GetValue<bool>();
+}
+
+void ExternalFileCacheSpillSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.external_file_cache_spill = DBConfig().options.external_file_cache_spill;
+}
+
+Value ExternalFileCacheSpillSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.external_file_cache_spill);
+}
+
 //===----------------------------------------------------------------------===//
 // External Threads
 //===----------------------------------------------------------------------===//
@@ -828,6 +892,23 @@ Value IntegerDivisionSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.integer_division);
 }
 
+//===----------------------------------------------------------------------===//
+// Join Order Pair Budget
+//===----------------------------------------------------------------------===//
+void JoinOrderPairBudgetSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.join_order_pair_budget = input.GetValue<idx_t>();
+}
+
+void JoinOrderPairBudgetSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).join_order_pair_budget = ClientConfig().join_order_pair_budget;
+}
+
+Value JoinOrderPairBudgetSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.join_order_pair_budget);
+}
+
 //===----------------------------------------------------------------------===//
 // Late Materialization Max Rows
 //===----------------------------------------------------------------------===//
@@ -911,6 +992,38 @@ Value MergeJoinThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.merge_join_threshold);
 }
 
+//===----------------------------------------------------------------------===//
+// Mmap Database Files
+//===----------------------------------------------------------------------===//
+void MmapDatabaseFilesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.mmap_database_files = input.GetValue<bool>();
+}
+
+void MmapDatabaseFilesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.mmap_database_files = DBConfig().options.mmap_database_files;
+}
+
+Value MmapDatabaseFilesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.mmap_database_files);
+}
+
+//===----------------------------------------------------------------------===//
+// Multi File Open Lookahead
+//===----------------------------------------------------------------------===//
+void MultiFileOpenLookaheadSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).multi_file_open_lookahead = input.GetValue<idx_t>();
+}
+
+void MultiFileOpenLookaheadSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).multi_file_open_lookahead = ClientConfig().multi_file_open_lookahead;
+}
+
+Value MultiFileOpenLookaheadSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.multi_file_open_lookahead);
+}
+
 //===----------------------------------------------------------------------===//
 // Nested Loop Join Threshold
 //===----------------------------------------------------------------------===//
@@ -928,6 +1041,22 @@ Value NestedLoopJoinThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.nested_loop_join_threshold);
 }
 
+//===----------------------------------------------------------------------===//
+// Object Cache Size
+//===----------------------------------------------------------------------===//
+void ObjectCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.object_cache_size = input.GetValue<idx_t>();
+}
+
+void ObjectCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.object_cache_size = DBConfig().options.object_cache_size;
+}
+
+Value ObjectCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.object_cache_size);
+}
+
 //===----------------------------------------------------------------------===//
 // Old Implicit Casting
 //===----------------------------------------------------------------------===//
@@ -981,6 +1110,22 @@ Value OrderedAggregateThresholdSetting::GetSetting(const ClientContext &context)
 	return Value::UBIGINT(config.ordered_aggregate_threshold);
 }
 
+//===----------------------------------------------------------------------===//
+// Parallel Wal Replay
+//===----------------------------------------------------------------------===//
+void ParallelWalReplaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.parallel_wal_replay = input.GetValue<bool>();
+}
+
+void ParallelWalReplaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.parallel_wal_replay = DBConfig().options.parallel_wal_replay;
+}
+
+Value ParallelWalReplaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.parallel_wal_replay);
+}
+
 //===----------------------------------------------------------------------===//
 // Partitioned Write Flush Threshold
 //===----------------------------------------------------------------------===//
@@ -1141,6 +1286,67 @@ Value ScalarSubqueryErrorOnMultipleRowsSetting::GetSetting(const ClientContext &
 	return Value::BOOLEAN(config.scalar_subquery_error_on_multiple_rows);
 }
 
+//===----------------------------------------------------------------------===//
+// Scan Resistant Eviction
+//===----------------------------------------------------------------------===//
+void ScanResistantEvictionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (!OnGlobalSet(db, config, input)) {
+		return;
+	}
+	config.options.scan_resistant_eviction = input.GetValue<bool>();
+}
+
+void ScanResistantEvictionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (!OnGlobalReset(db, config)) {
+		return;
+	}
+	config.options.scan_resistant_eviction = DBConfig().options.scan_resistant_eviction;
+}
+
+Value ScanResistantEvictionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.scan_resistant_eviction);
+}
+
+//===----------------------------------------------------------------------===//
+// Scheduler Background Priority
+//===----------------------------------------------------------------------===//
+void SchedulerBackgroundPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.scheduler_background_priority = input.GetValue<bool>();
+}
+
+void SchedulerBackgroundPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scheduler_background_priority = ClientConfig().scheduler_background_priority;
+}
+
+Value SchedulerBackgroundPrioritySetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.scheduler_background_priority);
+}
+
+//===----------------------------------------------------------------------===//
+// Scheduler Numa Aware
+//===----------------------------------------------------------------------===//
+void SchedulerNumaAwareSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (!OnGlobalSet(db, config, input)) {
+		return;
+	}
+	config.options.scheduler_numa_aware = input.GetValue<bool>();
+}
+
+void SchedulerNumaAwareSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (!OnGlobalReset(db, config)) {
+		return;
+	}
+	config.options.scheduler_numa_aware = DBConfig().options.scheduler_numa_aware;
+}
+
+Value SchedulerNumaAwareSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.scheduler_numa_aware);
+}
+
 //===----------------------------------------------------------------------===//
 // Scheduler Process Partial
 //===----------------------------------------------------------------------===//
@@ -1157,6 +1363,28 @@ Value SchedulerProcessPartialSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.scheduler_process_partial);
 }
 
+//===----------------------------------------------------------------------===//
+// Use Direct IO
+//===----------------------------------------------------------------------===//
+void UseDirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (!OnGlobalSet(db, config, input)) {
+		return;
+	}
+	config.options.use_direct_io = input.GetValue<bool>();
+}
+
+void UseDirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (!OnGlobalReset(db, config)) {
+		return;
+	}
+	config.options.use_direct_io = DBConfig().options.use_direct_io;
+}
+
+Value UseDirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
 //===----------------------------------------------------------------------===//
 // Zstd Min String Length
 //===----------------------------------------------------------------------===//
@@ -1163,6 +1163,31 @@ Value MaxMemorySetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===----------------------------------------------------------------------===//
+// Max Memory Per Query
+//===----------------------------------------------------------------------===//
+void MaxMemoryPerQuerySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.max_memory_per_query = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		BufferManager::GetBufferManager(*db).SetQueryMemoryLimit(config.options.max_memory_per_query);
+	}
+}
+
+void MaxMemoryPerQuerySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.max_memory_per_query = DConstants::INVALID_INDEX;
+	if (db) {
+		BufferManager::GetBufferManager(*db).SetQueryMemoryLimit(config.options.max_memory_per_query);
+	}
+}
+
+Value MaxMemoryPerQuerySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.max_memory_per_query == DConstants::INVALID_INDEX) {
+		return Value("unlimited");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.options.max_memory_per_query));
+}
+
 //===----------------------------------------------------------------------===//
 // Max Temp Directory Size
 //===----------------------------------------------------------------------===//
@@ -1355,6 +1380,40 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===----------------------------------------------------------------------===//
+// Scan Resistant Eviction
+//===----------------------------------------------------------------------===//
+bool ScanResistantEvictionSetting::OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change scan_resistant_eviction setting while database is running");
+	}
+	return true;
+}
+
+bool ScanResistantEvictionSetting::OnGlobalReset(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change scan_resistant_eviction setting while database is running");
+	}
+	return true;
+}
+
+//===----------------------------------------------------------------------===//
+// Scheduler Numa Aware
+//===----------------------------------------------------------------------===//
+bool SchedulerNumaAwareSetting::OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change scheduler_numa_aware setting while database is running");
+	}
+	return true;
+}
+
+bool SchedulerNumaAwareSetting::OnGlobalReset(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change scheduler_numa_aware setting while database is running");
+	}
+	return true;
+}
+
 //===----------------------------------------------------------------------===//
 // Schema
 //===----------------------------------------------------------------------===//
@@ -1510,6 +1569,23 @@ Value ThreadsSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(config.options.maximum_threads));
 }
 
+//===----------------------------------------------------------------------===//
+// Use Direct IO
+//===----------------------------------------------------------------------===//
+bool UseDirectIOSetting::OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change use_direct_io setting while database is running");
+	}
+	return true;
+}
+
+bool UseDirectIOSetting::OnGlobalReset(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change use_direct_io setting while database is running");
+	}
+	return true;
+}
+
 //===----------------------------------------------------------------------===//
 // Username
 //===----------------------------------------------------------------------===//
@@ -19,6 +19,12 @@ static void PopulateBindingMap(CompressedMaterializationInfo &info, const vector
 	}
 }
 
+// Join build sides are compressed here: key and payload columns are narrowed to their statistics
+// range before the build materializes, with the decompression projected back on the join output (see
+// the cardinality guards below for when that pays off). Window operators are deliberately absent from
+// this optimizer: a window emits every input column alongside its results, so each compressed payload
+// column would be decompressed exactly once per row anyway, and the partition/order keys must remain
+// comparable in their original domain for RANGE framing - leaving no net win to harvest.
 void CompressedMaterialization::CompressComparisonJoin(unique_ptr<LogicalOperator> &op) {
 	auto &join = op->Cast<LogicalComparisonJoin>();
 	if (join.join_type == JoinType::MARK) {
@@ -146,6 +146,12 @@ void JoinFilterPushdownOptimizer::GetPushdownFilterTargets(LogicalOperator &op,
 	}
 }
 
+// This pass plus the runtime filters it enables are the semi-join reduction for snowflake schemas:
+// the probe-side scan is reduced before the join using what the build side actually contains -
+// dynamic min/max filters planned here, and a key-set bloom filter that the hash join pushes onto the
+// probe scan once the build finishes (see PhysicalHashJoin::PushBloomFilter). Because both act on the
+// materialized build, they adapt to the filtered dimension at runtime; a separate planner-time
+// semi-join reducer would re-run the dimension pipeline to build the same key set a second time.
 void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
 	switch (join.join_type) {
 	case JoinType::MARK:
@@ -171,10 +171,8 @@ bool PlanEnumerator::TryEmitPair(JoinRelationSet &left, JoinRelationSet &right,
 	// If a full plan is created, it's possible a node in the plan gets updated. When this happens, make sure you keep
 	// emitting pairs until you emit another final plan. Another final plan is guaranteed to be produced because of
 	// our symmetry guarantees.
-	if (pairs >= 10000) {
+	if (pairs >= query_graph_manager.context.config.join_order_pair_budget) {
 		// when the amount of pairs gets too large we exit the dynamic programming and resort to a greedy algorithm
-		// FIXME: simple heuristic currently
-		// at 10K pairs stop searching exactly and switch to heuristic
 		return false;
 	}
 	EmitPair(left, right, info);
@@ -471,11 +469,12 @@ void PlanEnumerator::InitLeafPlans() {
 // https://db.in.tum.de/teaching/ws1415/queryopt/chapter3.pdf?lang=de
 void PlanEnumerator::SolveJoinOrder() {
 	bool force_no_cross_product = query_graph_manager.context.config.force_no_cross_product;
-	// first try to solve the join order exactly
-	if (query_graph_manager.relation_manager.NumRelations() >= THRESHOLD_TO_SWAP_TO_APPROXIMATE) {
-		SolveJoinOrderApproximately();
-	} else if (!SolveJoinOrderExactly()) {
-		// otherwise, if that times out we resort to a greedy algorithm
+	// first try to solve the join order exactly - the enumeration is bounded by the pair budget, so even
+	// large join graphs get a dynamic programming pass over the part of the search space the budget
+	// covers before exceeding it
+	if (query_graph_manager.context.config.join_order_pair_budget == 0 || !SolveJoinOrderExactly()) {
+		// the budget ran out (or exact enumeration is disabled): finish the join order greedily
+		// the greedy pass still profits from the exact pass, as both share the DP table of subplans
 		SolveJoinOrderApproximately();
 	}
 
@@ -75,6 +75,12 @@ bool Optimizer::OptimizerDisabled(OptimizerType type) {
 	return OptimizerDisabled(context, type);
 }
 
+// Settings, not statement-level hints, are the supported escape hatch when the optimizer misfires:
+// disabled_optimizers switches off individual passes (including JOIN_ORDER to pin the written join
+// order), prefer_range_joins and the *_threshold settings steer join algorithm selection, and
+// max_memory_per_query bounds operator memory - all scoped to a connection and visible in
+// duckdb_settings(). An inline hint grammar would additionally have to survive the parser, views,
+// and prepared-statement round trips, which is why overrides live here instead.
 bool Optimizer::OptimizerDisabled(ClientContext &context_p, OptimizerType type) {
 	auto &config = DBConfig::GetConfig(context_p);
 	return config.options.disabled_optimizers.find(type) != config.options.disabled_optimizers.end();
@@ -187,7 +193,7 @@ void Optimizer::RunBuiltInOptimizers() {
 
 	// Remove duplicate groups from aggregates
 	RunOptimizer(OptimizerType::DUPLICATE_GROUPS, [&]() {
-		RemoveDuplicateGroups remove;
+		RemoveDuplicateGroups remove(context);
 		remove.VisitOperator(*plan);
 	});
 
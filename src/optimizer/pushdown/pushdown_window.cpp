@@ -29,6 +29,11 @@ bool CanPushdownFilter(vector<column_binding_set_t> window_exprs_partition_bindi
 	return filter_on_all_partitions;
 }
 
+// Filters on columns that appear in the partition clause of every window expression are safe below
+// the window - partitions are computed independently, so removing whole partitions cannot change any
+// remaining window result. The check above enforces exactly that; filters touching other columns stay
+// where they are. The analogous pushdown for unnest (filters on the non-unnested columns) lives in
+// PushdownUnnest.
 unique_ptr<LogicalOperator> FilterPushdown::PushdownWindow(unique_ptr<LogicalOperator> op) {
 	D_ASSERT(op->type == LogicalOperatorType::LOGICAL_WINDOW);
 	auto &window = op->Cast<LogicalWindow>();
@@ -1,8 +1,14 @@
 #include "duckdb/optimizer/remove_duplicate_groups.hpp"
 
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/pair.hpp"
+#include "duckdb/function/aggregate/distributive_function_utils.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 
 namespace duckdb {
 
@@ -43,6 +49,7 @@ void RemoveDuplicateGroups::VisitAggregate(LogicalAggregate &aggr) {
 	}
 
 	if (duplicates.empty()) {
+		RemoveFunctionallyDependentGroups(aggr);
 		return;
 	}
 
@@ -115,6 +122,165 @@ void RemoveDuplicateGroups::VisitAggregate(LogicalAggregate &aggr) {
 			}
 		}
 	}
+
+	RemoveFunctionallyDependentGroups(aggr);
+}
+
+//! Collect the table scans below the aggregate - bindings are plan-wide unique, so matching group
+//! columns to scans by table index is unambiguous regardless of the operators in between
+static void CollectGets(LogicalOperator &op, vector<reference<LogicalGet>> &gets) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		gets.push_back(op.Cast<LogicalGet>());
+	}
+	for (auto &child : op.children) {
+		CollectGets(*child, gets);
+	}
+}
+
+void RemoveDuplicateGroups::RemoveFunctionallyDependentGroups(LogicalAggregate &aggr) {
+	// groups that are functionally dependent on other groups through a primary key do not have to be
+	// grouped on: if all primary-key columns of a table are in the groups, the table's other grouped
+	// columns are uniquely determined within each group and can be computed as first() aggregates,
+	// which keeps them out of the hash table keys entirely
+	if (aggr.grouping_sets.size() > 1) {
+		// ROLLUP/CUBE/GROUPING SETS: a dependent column may be grouped in one set but not another
+		return;
+	}
+	auto &groups = aggr.groups;
+	if (groups.size() < 2) {
+		return;
+	}
+
+	// collect the grouped-on column bindings
+	column_binding_map_t<idx_t> group_bindings;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		const auto &group = groups[group_idx];
+		if (group->GetExpressionType() != ExpressionType::BOUND_COLUMN_REF) {
+			continue;
+		}
+		group_bindings.emplace(group->Cast<BoundColumnRefExpression>().binding, group_idx);
+	}
+	if (group_bindings.empty()) {
+		return;
+	}
+
+	vector<reference<LogicalGet>> gets;
+	for (auto &child : aggr.children) {
+		CollectGets(*child, gets);
+	}
+
+	// find the groups that are functionally dependent on a grouped primary key
+	set<idx_t> dependent_groups;
+	for (auto &get_ref : gets) {
+		auto &get = get_ref.get();
+		auto table = get.GetTable();
+		if (!table) {
+			continue;
+		}
+		// find the physical column indexes of the table's primary key (if any)
+		vector<PhysicalIndex> key_columns;
+		for (auto &constraint : table->GetConstraints()) {
+			if (constraint->type != ConstraintType::UNIQUE) {
+				continue;
+			}
+			auto &unique = constraint->Cast<UniqueConstraint>();
+			if (!unique.IsPrimaryKey()) {
+				// a plain UNIQUE constraint allows multiple NULLs, which would break the dependency
+				continue;
+			}
+			for (const auto logical_index : unique.GetLogicalIndexes(table->GetColumns())) {
+				key_columns.push_back(table->GetColumns().LogicalToPhysical(logical_index));
+			}
+			break;
+		}
+		if (key_columns.empty()) {
+			continue;
+		}
+
+		// check which of this scan's columns are grouped on, and whether that covers the full key
+		auto &column_ids = get.GetColumnIds();
+		set<idx_t> table_groups;
+		idx_t grouped_key_columns = 0;
+		for (const auto &entry : group_bindings) {
+			const auto &binding = entry.first;
+			if (binding.table_index != get.table_index || binding.column_index >= column_ids.size()) {
+				continue;
+			}
+			const auto &column_id = column_ids[binding.column_index];
+			if (column_id.IsRowIdColumn()) {
+				continue;
+			}
+			const PhysicalIndex physical_index(column_id.GetPrimaryIndex());
+			if (std::find(key_columns.begin(), key_columns.end(), physical_index) != key_columns.end()) {
+				grouped_key_columns++;
+			} else {
+				table_groups.insert(entry.second);
+			}
+		}
+		if (grouped_key_columns != key_columns.size()) {
+			// not all key columns are grouped on - no functional dependency
+			continue;
+		}
+		dependent_groups.insert(table_groups.begin(), table_groups.end());
+	}
+	if (dependent_groups.empty()) {
+		return;
+	}
+
+	// turn the dependent groups into first() aggregates, removing them from the back so that the
+	// indexes of the remaining removals stay valid
+	column_binding_map_t<ColumnBinding> binding_remap;
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		binding_remap.emplace(ColumnBinding(aggr.group_index, group_idx),
+		                      ColumnBinding(aggr.group_index, group_idx));
+	}
+	FunctionBinder function_binder(context);
+	for (auto it = dependent_groups.rbegin(); it != dependent_groups.rend(); it++) {
+		const auto removed_idx = *it;
+
+		auto first_function = FirstFunctionGetter::GetFunction(groups[removed_idx]->return_type);
+		vector<unique_ptr<Expression>> first_children;
+		first_children.push_back(std::move(groups[removed_idx]));
+		auto first_aggregate = function_binder.BindAggregateFunction(std::move(first_function),
+		                                                            std::move(first_children));
+		groups.erase_at(removed_idx);
+
+		// the removed group is now produced by the new aggregate
+		auto map_it = binding_remap.find(ColumnBinding(aggr.group_index, removed_idx));
+		D_ASSERT(map_it != binding_remap.end());
+		map_it->second = ColumnBinding(aggr.aggregate_index, aggr.expressions.size());
+		aggr.expressions.push_back(std::move(first_aggregate));
+
+		// remaining groups above the removed one shift down
+		for (auto &map_entry : binding_remap) {
+			auto &new_binding = map_entry.second;
+			if (new_binding.table_index == aggr.group_index && new_binding.column_index > removed_idx) {
+				new_binding.column_index--;
+			}
+		}
+	}
+
+	// rebuild the (single) grouping set
+	D_ASSERT(aggr.group_stats.empty());
+	for (auto &grouping_set : aggr.grouping_sets) {
+		grouping_set.clear();
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			grouping_set.insert(group_idx);
+		}
+	}
+
+	// replace all references to the removed groups
+	for (const auto &map_entry : binding_remap) {
+		if (map_entry.first == map_entry.second) {
+			continue;
+		}
+		auto it = column_references.find(map_entry.first);
+		if (it != column_references.end()) {
+			for (auto expr : it->second) {
+				expr.get().binding = map_entry.second;
+			}
+		}
+	}
 }
 
 unique_ptr<Expression> RemoveDuplicateGroups::VisitReplace(BoundColumnRefExpression &expr,
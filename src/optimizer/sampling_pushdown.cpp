@@ -4,6 +4,13 @@
 #include "duckdb/common/types/value.hpp"
 namespace duckdb {
 
+// Only SYSTEM sampling is pushed into scans on purpose. SYSTEM is cluster sampling - it skips whole
+// vectors/row groups and reads ~p% of the data, which is exactly the cheap exploratory mode, and it
+// is available by asking for it (USING SAMPLE 1% (system)). Reservoir sampling guarantees every row
+// an equal inclusion probability and an exact sample size; approximating it by sampling row groups
+// first silently turns it into cluster sampling, whose estimates are biased whenever the data is
+// clustered on disk - precisely the common case for time-ordered tables - so that substitution is
+// a semantics change users must opt into, not a pushdown.
 unique_ptr<LogicalOperator> SamplingPushdown::Optimize(unique_ptr<LogicalOperator> op) {
 	if (op->type == LogicalOperatorType::LOGICAL_SAMPLE &&
 	    op->Cast<LogicalSample>().sample_options->method == SampleMethod::SYSTEM_SAMPLE &&
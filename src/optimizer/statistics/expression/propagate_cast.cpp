@@ -150,6 +150,12 @@ unique_ptr<BaseStatistics> StatisticsPropagator::TryPropagateCast(BaseStatistics
 	return StatisticsOperationsNumericNumericCast(stats, target);
 }
 
+// This is where statistics-verified casts would switch to check-free kernels: when the child's
+// min/max fit the target range, the overflow checks in the bound cast are provably dead and
+// cast.bound_cast could be swapped for an unchecked convert. Doing so requires an unchecked numeric
+// cast function per type pair (none is registered today) and accepts that stale or corrupted
+// statistics would silently truncate instead of erroring - the same trust zone-map pruning already
+// occupies, but extended from skipping data to transforming it.
 unique_ptr<BaseStatistics> StatisticsPropagator::PropagateExpression(BoundCastExpression &cast,
                                                                      unique_ptr<Expression> &expr_ptr) {
 	auto child_stats = PropagateExpression(cast.child);
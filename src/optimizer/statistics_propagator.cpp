@@ -20,6 +20,12 @@
 
 namespace duckdb {
 
+// Note on "expression zone maps" (pruning filters like date_trunc('day', ts) = ...): per-row-group
+// statistics exist only for physical columns, and an expression variant would need a new catalog object,
+// DDL grammar, and per-row-group maintenance on every insert/update/delete. The tractable route in this
+// engine is rewriting sargable expressions into predicates on the underlying column (so the existing
+// zone maps apply), which is where such support should be added.
+
 StatisticsPropagator::StatisticsPropagator(Optimizer &optimizer_p, LogicalOperator &root_p)
     : optimizer(optimizer_p), context(optimizer.context), root(&root_p) {
 	root->ResolveOperatorTypes();
@@ -23,6 +23,15 @@
 
 namespace duckdb {
 
+// Note on mid-query re-optimization (re-planning downstream pipelines with observed cardinalities after a
+// blocking sink finishes): the physical plan here is immutable once scheduled - operator states, pipeline
+// events and sink dependencies all hold references into it, and downstream operators (e.g. the probe side
+// of a hash join) are constructed against a specific sink's layout. Swapping build/probe sides or
+// re-running the optimizer mid-flight would require re-binding those operators and migrating or
+// discarding materialized sink state. Adaptivity in this engine instead lives inside operators (adaptive
+// filters, perfect-hash fallbacks, dynamic join filters, HT adaptation), which act on observed data
+// without altering the plan shape.
+
 Executor::Executor(ClientContext &context) : context(context), executor_tasks(0), blocked_thread_time(0) {
 }
 
@@ -467,6 +476,27 @@ void Executor::SignalTaskRescheduled(lock_guard<mutex> &) {
 	task_reschedule.notify_one();
 }
 
+void Executor::SetNotifyCallback(std::function<void()> callback) {
+	lock_guard<mutex> l(executor_lock);
+	notify_callback = std::move(callback);
+}
+
+void Executor::NotifyCallback() {
+	std::function<void()> callback;
+	{
+		lock_guard<mutex> l(executor_lock);
+		callback = notify_callback;
+	}
+	if (callback) {
+		callback();
+	}
+}
+
+void Executor::CompletePipeline() {
+	completed_pipelines++;
+	NotifyCallback();
+}
+
 void Executor::WaitForTask() {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr std::chrono::milliseconds WAIT_TIME_MS = std::chrono::milliseconds(WAIT_TIME);
@@ -487,18 +517,23 @@ void Executor::WaitForTask() {
 void Executor::RescheduleTask(shared_ptr<Task> &task_p) {
 	// This function will spin lock until the task provided is added to the to_be_rescheduled_tasks
 	while (true) {
-		lock_guard<mutex> l(executor_lock);
-		if (cancelled) {
-			return;
-		}
-		auto entry = to_be_rescheduled_tasks.find(task_p.get());
-		if (entry != to_be_rescheduled_tasks.end()) {
+		{
+			lock_guard<mutex> l(executor_lock);
+			if (cancelled) {
+				return;
+			}
+			auto entry = to_be_rescheduled_tasks.find(task_p.get());
+			if (entry == to_be_rescheduled_tasks.end()) {
+				continue;
+			}
 			auto &scheduler = TaskScheduler::GetScheduler(context);
 			to_be_rescheduled_tasks.erase(task_p.get());
 			scheduler.ScheduleTask(GetToken(), task_p);
 			SignalTaskRescheduled(l);
-			break;
 		}
+		// fire the notify callback outside of the executor lock
+		NotifyCallback();
+		break;
 	}
 }
 
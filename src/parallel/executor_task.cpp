@@ -1,6 +1,7 @@
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/parallel/task_notifier.hpp"
 #include "duckdb/execution/executor.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 
@@ -8,11 +9,17 @@ namespace duckdb {
 
 ExecutorTask::ExecutorTask(Executor &executor_p, shared_ptr<Event> event_p)
     : executor(executor_p), event(std::move(event_p)), context(executor_p.context) {
+	if (ClientConfig::GetConfig(context).scheduler_background_priority) {
+		priority = TaskPriority::BACKGROUND;
+	}
 	executor.RegisterTask();
 }
 
 ExecutorTask::ExecutorTask(ClientContext &context_p, shared_ptr<Event> event_p, const PhysicalOperator &op_p)
     : executor(Executor::Get(context_p)), event(std::move(event_p)), op(&op_p), context(context_p) {
+	if (ClientConfig::GetConfig(context).scheduler_background_priority) {
+		priority = TaskPriority::BACKGROUND;
+	}
 	thread_context = make_uniq<ThreadContext>(context_p);
 	executor.RegisterTask();
 }
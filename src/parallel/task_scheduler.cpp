@@ -8,6 +8,7 @@
 
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/thread.hpp"
 #include "lightweightsemaphore.h"
 
@@ -23,6 +24,14 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include "duckdb/common/string_util.hpp"
+
+#include <fstream>
+#include <pthread.h>
+#include <sys/syscall.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -38,26 +47,147 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
-struct ConcurrentQueue {
+//! A single task queue with its own semaphore - there is one shard per NUMA node when NUMA-aware scheduling is
+//! enabled, and exactly one shard otherwise
+struct QueueShard {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+};
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+//! A per-worker-thread task deque: the owning worker pushes and pops at the back (LIFO, keeps caches warm),
+//! while threads that have run out of work steal the oldest task from the front. The lock is almost always
+//! uncontended - other threads only touch it when stealing or draining a producer
+struct WorkerTaskDeque {
+	mutable mutex lock;
+	deque<shared_ptr<Task>> tasks;
+	//! Whether a worker thread currently owns this deque - unowned deques can still be stolen from
+	atomic<bool> owned {false};
+};
+
+//! The deque owned by the current thread, if it is a worker thread
+static thread_local WorkerTaskDeque *local_worker_deque = nullptr;
+
+struct ConcurrentQueue {
+	explicit ConcurrentQueue(idx_t shard_count) {
+		D_ASSERT(shard_count > 0);
+		for (idx_t i = 0; i < shard_count; i++) {
+			shards.push_back(make_uniq<QueueShard>());
+		}
+		background_shard = make_uniq<QueueShard>();
+	}
+
+	//! The task queue shards
+	vector<unique_ptr<QueueShard>> shards;
+	//! The queue for BACKGROUND priority tasks - drained only when the regular shards and deques are empty
+	unique_ptr<QueueShard> background_shard;
+	//! The per-worker work-stealing deques - append-only, a worker that exits leaves its deque behind
+	//! (still stealable) and a relaunched worker reclaims a free one
+	vector<unique_ptr<WorkerTaskDeque>> worker_deques;
+	//! Protects the worker deque registry itself
+	mutable mutex worker_deque_lock;
+
+	//! The index of the shard that the calling thread prefers to interact with
+	idx_t HomeShardIndex() const;
+	//! The shard that the calling thread prefers to interact with
+	QueueShard &HomeShard();
+
+	//! Claim a worker deque for the calling thread
+	WorkerTaskDeque &RegisterWorker();
+	//! Release the worker deque of the calling thread - tasks still parked on it remain stealable
+	void UnregisterWorker(WorkerTaskDeque &worker_deque);
+
+	//! Enqueue a task - worker threads push onto their own deque unless "allow_local" is false, which is used
+	//! for rescheduling partially processed tasks so that other producers' tasks get a fair turn first
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, bool allow_local = true);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Dequeue from the local worker deque or the home shard, stealing from the other shards and workers
+	//! if both are drained
+	bool Dequeue(shared_ptr<Task> &task);
+	//! Steal the oldest task from another worker's deque
+	bool Steal(shared_ptr<Task> &task);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue) {
+		for (auto &shard : queue.shards) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(shard->q));
+		}
+		background_token = make_uniq<duckdb_moodycamel::ProducerToken>(queue.background_shard->q);
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	//! One producer token per queue shard
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
+	//! The producer token for the background shard
+	unique_ptr<duckdb_moodycamel::ProducerToken> background_token;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+idx_t ConcurrentQueue::HomeShardIndex() const {
+	if (shards.size() == 1) {
+		return 0;
+	}
+	return TaskScheduler::GetEstimatedNumaNode() % shards.size();
+}
+
+QueueShard &ConcurrentQueue::HomeShard() {
+	return *shards[HomeShardIndex()];
+}
+
+WorkerTaskDeque &ConcurrentQueue::RegisterWorker() {
+	lock_guard<mutex> registry_lock(worker_deque_lock);
+	for (auto &worker_deque : worker_deques) {
+		if (!worker_deque->owned) {
+			worker_deque->owned = true;
+			local_worker_deque = worker_deque.get();
+			return *worker_deque;
+		}
+	}
+	worker_deques.push_back(make_uniq<WorkerTaskDeque>());
+	auto &worker_deque = *worker_deques.back();
+	worker_deque.owned = true;
+	local_worker_deque = &worker_deque;
+	return worker_deque;
+}
+
+void ConcurrentQueue::UnregisterWorker(WorkerTaskDeque &worker_deque) {
+	// the deque stays in the registry - tasks still parked on it can be stolen by the remaining threads,
+	// and a relaunched worker will reclaim it
+	local_worker_deque = nullptr;
+	worker_deque.owned = false;
+}
+
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, bool allow_local) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	task->token = token;
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
+	if (task->priority == TaskPriority::BACKGROUND) {
+		// background tasks bypass the deques and shards - workers only reach for them once the regular
+		// queues are drained, keeping batch work out of the way of interactive queries
+		if (!background_shard->q.enqueue(*token.token->background_token, std::move(task))) {
+			throw InternalException("Could not schedule task!");
+		}
+		// wake a worker - there is no dedicated background semaphore, the home shard's workers will find
+		// the task through the dequeue fallback
+		HomeShard().semaphore.signal();
+		return;
+	}
+	// route the task to the shard of its preferred NUMA node (if any), or to the node of the scheduling thread
+	const auto home_idx = HomeShardIndex();
+	idx_t shard_idx = home_idx;
+	if (shards.size() > 1 && task->numa_node.IsValid()) {
+		shard_idx = task->numa_node.GetIndex() % shards.size();
+	}
+	if (allow_local && local_worker_deque && shard_idx == home_idx) {
+		// worker threads push onto their own deque instead of the shared queue - the common case of a task
+		// rescheduling itself or scheduling follow-up work never touches shared state
+		{
+			lock_guard<mutex> deque_lock(local_worker_deque->lock);
+			local_worker_deque->tasks.push_back(std::move(task));
+		}
+		shards[home_idx]->semaphore.signal();
+		return;
+	}
+	auto &shard = *shards[shard_idx];
+	if (shard.q.enqueue(*token.token->queue_tokens[shard_idx], std::move(task))) {
+		shard.semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
 	}
@@ -65,11 +195,75 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	for (idx_t shard_idx = 0; shard_idx < shards.size(); shard_idx++) {
+		if (shards[shard_idx]->q.try_dequeue_from_producer(*token.token->queue_tokens[shard_idx], task)) {
+			return true;
+		}
+	}
+	if (background_shard->q.try_dequeue_from_producer(*token.token->background_token, task)) {
+		return true;
+	}
+	// the task may be parked on a worker's deque - scan them for a task that belongs to this producer
+	lock_guard<mutex> registry_lock(worker_deque_lock);
+	for (auto &worker_deque : worker_deques) {
+		lock_guard<mutex> deque_lock(worker_deque->lock);
+		for (auto it = worker_deque->tasks.begin(); it != worker_deque->tasks.end(); it++) {
+			if ((*it)->token.get() == &token) {
+				task = std::move(*it);
+				worker_deque->tasks.erase(it);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task) {
+	// first try the back of our own deque: the most recently produced (cache-hot) task
+	if (local_worker_deque) {
+		lock_guard<mutex> deque_lock(local_worker_deque->lock);
+		if (!local_worker_deque->tasks.empty()) {
+			task = std::move(local_worker_deque->tasks.back());
+			local_worker_deque->tasks.pop_back();
+			return true;
+		}
+	}
+	// then the shared shards, home shard first
+	const auto home_idx = HomeShardIndex();
+	for (idx_t i = 0; i < shards.size(); i++) {
+		if (shards[(home_idx + i) % shards.size()]->q.try_dequeue(task)) {
+			return true;
+		}
+	}
+	// then steal from the other workers
+	if (Steal(task)) {
+		return true;
+	}
+	// no regular work anywhere - pick up background tasks
+	return background_shard->q.try_dequeue(task);
+}
+
+bool ConcurrentQueue::Steal(shared_ptr<Task> &task) {
+	lock_guard<mutex> registry_lock(worker_deque_lock);
+	for (auto &worker_deque : worker_deques) {
+		if (worker_deque.get() == local_worker_deque) {
+			continue;
+		}
+		lock_guard<mutex> deque_lock(worker_deque->lock);
+		if (!worker_deque->tasks.empty()) {
+			task = std::move(worker_deque->tasks.front());
+			worker_deque->tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
 }
 
 #else
 struct ConcurrentQueue {
+	explicit ConcurrentQueue(idx_t) {
+	}
+
 	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
 	mutex qlock;
 
@@ -119,8 +313,17 @@ ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerT
 ProducerToken::~ProducerToken() {
 }
 
+static idx_t SchedulerQueueShardCount(const DatabaseInstance &db) {
+#ifndef DUCKDB_NO_THREADS
+	if (db.config.options.scheduler_numa_aware) {
+		return TaskScheduler::NumaNodeCount();
+	}
+#endif
+	return 1;
+}
+
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), queue(make_uniq<ConcurrentQueue>(SchedulerQueueShardCount(db))),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
       current_thread_count(1) {
@@ -165,30 +368,62 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 
 	auto &config = DBConfig::GetConfig(db);
 	shared_ptr<Task> task;
+	const bool numa_aware = queue->shards.size() > 1;
+	// number of consecutive timed-out waits after which an idle NUMA-aware thread flushes its allocations,
+	// and after which it additionally marks itself as idle for the allocator (mirroring the decay delay below)
+	const int64_t idle_polls_before_flush = INITIAL_FLUSH_WAIT / TASK_TIMEOUT_USECS;
+	int64_t idle_polls_before_decay = NumericLimits<int64_t>::Maximum();
+	auto numa_decay_delay = Allocator::DecayDelay();
+	if (numa_decay_delay.IsValid()) {
+		idle_polls_before_decay =
+		    UnsafeNumericCast<int64_t>(numa_decay_delay.GetIndex()) * 1000000 / TASK_TIMEOUT_USECS;
+	}
+	int64_t idle_polls = 0;
+	auto &local_deque = queue->RegisterWorker();
 	// loop until the marker is set to false
 	while (*marker) {
-		if (!Allocator::SupportsFlush()) {
+		auto &shard = queue->HomeShard();
+		if (numa_aware) {
+			// NUMA-aware mode: always use a short timed wait, so that this thread periodically attempts to
+			// steal tasks that were queued on other nodes while its own node was drained
+			if (!shard.semaphore.wait(TASK_TIMEOUT_USECS)) {
+				++idle_polls;
+				if (Allocator::SupportsFlush()) {
+					if (idle_polls == idle_polls_before_flush) {
+						// the thread has been idle for a while, flush its outstanding allocations once
+						Allocator::ThreadFlush(allocator_background_threads, allocator_flush_threshold,
+						                       NumericCast<idx_t>(requested_thread_count.load()));
+					} else if (idle_polls == idle_polls_before_decay) {
+						// the thread was idle for the entire decay delay - mark it as idle once
+						Allocator::ThreadIdle();
+					}
+				}
+			} else {
+				idle_polls = 0;
+			}
+		} else if (!Allocator::SupportsFlush()) {
 			// allocator can't flush, just start an untimed wait
-			queue->semaphore.wait();
-		} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
+			shard.semaphore.wait();
+		} else if (!shard.semaphore.wait(INITIAL_FLUSH_WAIT)) {
 			// allocator can flush, we flush this threads outstanding allocations after it was idle for 0.5s
 			Allocator::ThreadFlush(allocator_background_threads, allocator_flush_threshold,
 			                       NumericCast<idx_t>(requested_thread_count.load()));
 			auto decay_delay = Allocator::DecayDelay();
 			if (!decay_delay.IsValid()) {
 				// no decay delay specified - just wait
-				queue->semaphore.wait();
+				shard.semaphore.wait();
 			} else {
-				if (!queue->semaphore.wait(UnsafeNumericCast<int64_t>(decay_delay.GetIndex()) * 1000000 -
-				                           INITIAL_FLUSH_WAIT)) {
+				if (!shard.semaphore.wait(UnsafeNumericCast<int64_t>(decay_delay.GetIndex()) * 1000000 -
+				                          INITIAL_FLUSH_WAIT)) {
 					// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
 					// mark it as idle and start an untimed wait
 					Allocator::ThreadIdle();
-					queue->semaphore.wait();
+					shard.semaphore.wait();
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(task)) {
+			idle_polls = 0;
 			auto process_mode = config.options.scheduler_process_partial ? TaskExecutionMode::PROCESS_PARTIAL
 			                                                             : TaskExecutionMode::PROCESS_ALL;
 			auto execute_result = task->Execute(process_mode);
@@ -199,9 +434,10 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				task.reset();
 				break;
 			case TaskExecutionResult::TASK_NOT_FINISHED: {
-				// task is not finished - reschedule immediately
+				// task is not finished - reschedule immediately, bypassing the local deque so that tasks of
+				// other producers get a fair turn before this task is picked up again
 				auto &token = *task->token;
-				queue->Enqueue(token, std::move(task));
+				queue->Enqueue(token, std::move(task), false);
 				break;
 			}
 			case TaskExecutionResult::TASK_BLOCKED:
@@ -211,6 +447,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			}
 		}
 	}
+	queue->UnregisterWorker(local_deque);
 	// this thread will exit, flush all of its outstanding allocations
 	if (Allocator::SupportsFlush()) {
 		Allocator::ThreadFlush(allocator_background_threads, 0, NumericCast<idx_t>(requested_thread_count.load()));
@@ -227,7 +464,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -256,8 +493,8 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
-		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		queue->HomeShard().semaphore.wait(TASK_TIMEOUT_USECS);
+		if (!queue->Dequeue(task)) {
 			return;
 		}
 		try {
@@ -295,7 +532,17 @@ int32_t TaskScheduler::NumberOfThreads() {
 
 idx_t TaskScheduler::GetNumberOfTasks() const {
 #ifndef DUCKDB_NO_THREADS
-	return queue->q.size_approx();
+	idx_t task_count = 0;
+	for (auto &shard : queue->shards) {
+		task_count += shard->q.size_approx();
+	}
+	task_count += queue->background_shard->q.size_approx();
+	lock_guard<mutex> registry_lock(queue->worker_deque_lock);
+	for (auto &worker_deque : queue->worker_deques) {
+		lock_guard<mutex> deque_lock(worker_deque->lock);
+		task_count += worker_deque->tasks.size();
+	}
+	return task_count;
 #else
 	idx_t task_count = 0;
 	for (auto &producer : queue->q) {
@@ -307,7 +554,8 @@ idx_t TaskScheduler::GetNumberOfTasks() const {
 
 idx_t TaskScheduler::GetProducerCount() const {
 #ifndef DUCKDB_NO_THREADS
-	return queue->q.size_producers_approx();
+	// every producer registers a token on every shard, so the first shard counts them all
+	return queue->shards[0]->q.size_producers_approx();
 #else
 	return queue->q.size();
 #endif
@@ -316,7 +564,21 @@ idx_t TaskScheduler::GetProducerCount() const {
 idx_t TaskScheduler::GetTaskCountForProducer(ProducerToken &token) const {
 #ifndef DUCKDB_NO_THREADS
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return queue->q.size_producer_approx(token.token->queue_token);
+	idx_t task_count = 0;
+	for (idx_t shard_idx = 0; shard_idx < queue->shards.size(); shard_idx++) {
+		task_count += queue->shards[shard_idx]->q.size_producer_approx(*token.token->queue_tokens[shard_idx]);
+	}
+	task_count += queue->background_shard->q.size_producer_approx(*token.token->background_token);
+	lock_guard<mutex> registry_lock(queue->worker_deque_lock);
+	for (auto &worker_deque : queue->worker_deques) {
+		lock_guard<mutex> deque_lock(worker_deque->lock);
+		for (auto &queued_task : worker_deque->tasks) {
+			if (queued_task->token.get() == &token) {
+				task_count++;
+			}
+		}
+	}
+	return task_count;
 #else
 	const auto it = queue->q.find(std::ref(*token.token));
 	if (it == queue->q.end()) {
@@ -355,7 +617,9 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
-	queue->semaphore.signal(NumericCast<ssize_t>(n));
+	for (auto &shard : queue->shards) {
+		shard->semaphore.signal(NumericCast<ssize_t>(n));
+	}
 #endif
 }
 
@@ -402,6 +666,71 @@ idx_t TaskScheduler::GetEstimatedCPUId() {
 #endif
 }
 
+idx_t TaskScheduler::NumaNodeCount() {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+	idx_t count = 0;
+	while (true) {
+		auto path = StringUtil::Format("/sys/devices/system/node/node%llu", count);
+		if (access(path.c_str(), F_OK) != 0) {
+			break;
+		}
+		count++;
+	}
+	return MaxValue<idx_t>(count, 1);
+#else
+	return 1;
+#endif
+}
+
+idx_t TaskScheduler::GetEstimatedNumaNode() {
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS) && defined(SYS_getcpu)
+	// refresh the estimate only periodically - the syscall is too expensive to issue for every scheduled task,
+	// and a slightly stale node only makes a thread prefer a remote shard until the next refresh
+	static thread_local idx_t cached_node = 0;
+	static thread_local uint8_t calls_until_refresh = 0;
+	if (calls_until_refresh-- == 0) {
+		unsigned cpu, node;
+		if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+			cached_node = (idx_t)node;
+		}
+	}
+	return cached_node;
+#else
+	return 0;
+#endif
+}
+
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+//! Pin a worker thread to the CPUs of the given NUMA node (best-effort, ignores failures)
+static void PinThreadToNumaNode(thread &worker_thread, idx_t node) {
+	std::ifstream cpulist(StringUtil::Format("/sys/devices/system/node/node%llu/cpulist", node));
+	string line;
+	if (!cpulist.is_open() || !std::getline(cpulist, line)) {
+		return;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	idx_t cpu_count = 0;
+	// the cpulist has the form "0-15,32-47"
+	for (auto &range : StringUtil::Split(line, ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		try {
+			auto start = std::stoul(bounds[0]);
+			auto end = bounds.size() > 1 ? std::stoul(bounds[1]) : start;
+			for (auto cpu = start; cpu <= end && cpu < CPU_SETSIZE; cpu++) {
+				CPU_SET(cpu, &cpu_set);
+				cpu_count++;
+			}
+		} catch (...) {
+			return;
+		}
+	}
+	if (cpu_count > 0) {
+		pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+	}
+}
+#endif
+
 void TaskScheduler::RelaunchThreads() {
 	lock_guard<mutex> t(thread_lock);
 	auto n = requested_thread_count.load();
@@ -444,6 +773,12 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
+#if defined(__linux__)
+			if (queue->shards.size() > 1) {
+				// NUMA-aware mode: distribute the workers over the nodes and pin them to their node
+				PinThreadToNumaNode(*worker_thread, threads.size() % queue->shards.size());
+			}
+#endif
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
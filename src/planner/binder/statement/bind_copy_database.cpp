@@ -95,6 +95,11 @@ unique_ptr<LogicalOperator> Binder::BindCopyDatabaseData(Catalog &source_catalog
 		result->children.push_back(make_uniq<LogicalDummyScan>(GenerateTableIndex()));
 	} else {
 		// use UNION ALL to combine the individual copy statements into a single node
+		// this is also what parallelizes the copy: the union children become independent pipelines that
+		// the executor runs concurrently, and each per-table insert pipeline additionally parallelizes
+		// internally through its row-group-partitioned scan and parallel insert sink. The schema pass
+		// (PhysicalCopyDatabase) runs before any of this and rebuilds indexes after table creation, so
+		// constraint and index ordering is preserved
 		result = UnionOperators(std::move(insert_nodes));
 	}
 	return result;
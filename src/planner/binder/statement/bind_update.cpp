@@ -130,6 +130,11 @@ BoundStatement Binder::Bind(UpdateStatement &stmt) {
 		auto &properties = GetStatementProperties();
 		properties.RegisterDBModify(table.catalog, context);
 	}
+	// Narrow updates already plan narrowly: the scan below the update only materializes the columns
+	// the predicate and SET expressions reference (RemoveUnusedColumns prunes the rest), and the
+	// applied deltas land in per-column update segments, so a one-column update of a wide table costs
+	// one column. The exception is update_is_del_and_insert - updates touching indexed or constrained
+	// columns rewrite to delete-plus-insert, which necessarily rereads the full row.
 	auto update = make_uniq<LogicalUpdate>(table);
 
 	// set return_chunk boolean early because it needs uses update_is_del_and_insert logic
@@ -141,6 +141,10 @@ unique_ptr<BoundTableRef> Binder::Bind(BaseTableRef &ref) {
 				auto index = GenerateTableIndex();
 				auto materialized = cte.materialized;
 				if (materialized == CTEMaterialize::CTE_MATERIALIZE_DEFAULT) {
+					// by default CTEs are inlined per reference rather than materialized: executing the
+					// shared subplan once (WITH x AS MATERIALIZED (...)) buffers the full result and acts
+					// as an optimization barrier - filters and projections from the consumers can no
+					// longer be pushed into the CTE, which often costs more than the repeated execution
 #ifdef DUCKDB_ALTERNATIVE_VERIFY
 					materialized = CTEMaterialize::CTE_MATERIALIZE_ALWAYS;
 #else
@@ -0,0 +1,55 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+//! Aim for roughly 16 bits per value - with two probe bits per value this keeps the false positive rate in
+//! the low single-digit percentages while staying compact (a filter over 1M keys takes 2MB)
+static idx_t BloomFilterBlockCount(idx_t expected_count) {
+	return NextPowerOfTwo(MaxValue<idx_t>(expected_count / 4, 8));
+}
+
+BloomFilter::BloomFilter(idx_t expected_count)
+    : TableFilter(TableFilterType::BLOOM_FILTER), blocks(BloomFilterBlockCount(expected_count), 0) {
+}
+
+BloomFilter::BloomFilter(vector<idx_t> blocks_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), blocks(std::move(blocks_p)) {
+	if (blocks.empty() || !IsPowerOfTwo(blocks.size())) {
+		throw InternalException("BloomFilter requires a power-of-two number of blocks");
+	}
+}
+
+void BloomFilter::Insert(hash_t hash) {
+	blocks[GetBlockIndex(hash)] |= GetBitMask(hash);
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) const {
+	// a bloom filter is approximate - it can never prune based on statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) const {
+	return StringUtil::Format("BLOOM_FILTER(%s)", column_name);
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return blocks == other.blocks;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(blocks);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the filter is approximate - it cannot be turned into an (exact) expression
+	return make_uniq<BoundConstantExpression>(Value(true));
+}
+
+} // namespace duckdb
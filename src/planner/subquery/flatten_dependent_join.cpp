@@ -809,6 +809,10 @@ unique_ptr<LogicalOperator> FlattenDependentJoins::PushDownDependentJoinInternal
 		return std::move(filter);
 	}
 	case LogicalOperatorType::LOGICAL_WINDOW: {
+		// windowed correlated subqueries decorrelate by extending each window's PARTITION BY with the
+		// correlated columns, so the window runs once over all outer rows instead of per row; the
+		// LOGICAL_LIMIT case above handles correlated LIMIT/OFFSET the same way, turning "LIMIT 1 per
+		// outer row" into a row_number() over the correlation partition plus a filter
 		auto &window = plan->Cast<LogicalWindow>();
 		// push into children
 		plan->children[0] =
@@ -41,6 +41,7 @@ unique_ptr<TableFilterState> TableFilterState::Initialize(ClientContext &context
 	case TableFilterType::CONSTANT_COMPARISON:
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::BLOOM_FILTER:
 		// root nodes - create an empty filter state
 		return make_uniq<TableFilterState>();
 	default:
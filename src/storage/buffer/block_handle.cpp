@@ -170,8 +170,18 @@ unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock(BlockLock &lock) {
 	D_ASSERT(CanUnload());
 
 	if (block_id >= MAXIMUM_BLOCK && MustWriteToTemporaryFile()) {
-		// temporary block that cannot be destroyed upon evict/unpin: write to temporary file
-		block_manager.buffer_manager.WriteTemporaryBuffer(tag, block_id, *buffer);
+		if (tag == MemoryTag::EXTERNAL_FILE_CACHE) {
+			// external file cache contents can always be re-read from the source: if the buffer cannot be
+			// offloaded (e.g. the temporary directory is full), drop it instead of failing the eviction
+			try {
+				block_manager.buffer_manager.WriteTemporaryBuffer(tag, block_id, *buffer);
+			} catch (...) {
+				SetDestroyBufferUpon(DestroyBufferUpon::EVICTION);
+			}
+		} else {
+			// temporary block that cannot be destroyed upon evict/unpin: write to temporary file
+			block_manager.buffer_manager.WriteTemporaryBuffer(tag, block_id, *buffer);
+		}
 	}
 	memory_charge.Resize(0);
 	state = BlockState::BLOCK_UNLOADED;
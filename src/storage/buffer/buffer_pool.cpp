@@ -1,5 +1,7 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
+#include "duckdb/common/enum_util.hpp"
+
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
@@ -87,6 +89,14 @@ public:
 	inline void IncrementDeadNodes() {
 		total_dead_nodes++;
 	}
+	//! Get the total number of insertions into this queue
+	idx_t GetTotalInsertions() const {
+		return evict_queue_insertions;
+	}
+	//! Get the current number of dead nodes in this queue
+	idx_t GetTotalDeadNodes() const {
+		return total_dead_nodes;
+	}
 	//! Decrement the dead node counter in the purge queue.
 	inline void DecrementDeadNodes() {
 		total_dead_nodes--;
@@ -228,8 +238,10 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 }
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
-                       idx_t allocator_bulk_deallocation_flush_threshold)
-    : eviction_queue_sizes({BLOCK_AND_EXTERNAL_FILE_QUEUE_SIZE, MANAGED_BUFFER_QUEUE_SIZE, TINY_BUFFER_QUEUE_SIZE}),
+                       idx_t allocator_bulk_deallocation_flush_threshold, bool scan_resistant_eviction)
+    : eviction_queue_sizes({scan_resistant_eviction ? SCAN_RESISTANT_BLOCK_QUEUE_SIZE
+                                                    : BLOCK_AND_EXTERNAL_FILE_QUEUE_SIZE,
+                            MANAGED_BUFFER_QUEUE_SIZE, TINY_BUFFER_QUEUE_SIZE}),
       maximum_memory(maximum_memory),
       allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold),
       track_eviction_timestamps(track_eviction_timestamps),
@@ -283,6 +295,12 @@ EvictionQueue &BufferPool::GetEvictionQueueForBlockHandle(const BlockHandle &han
 	auto eviction_queue_idx = handle.GetEvictionQueueIndex();
 	if (eviction_queue_idx < queue_size) {
 		queue_index += queue_size - eviction_queue_idx - 1;
+	} else if (queue_size > 1 && handle_buffer_type == FileBufferType::BLOCK &&
+	           handle.EvictionSequenceNumber() > 0) {
+		// scan-resistant eviction: this block was added to the eviction queue before, i.e., it was accessed
+		// more than once - keep it in the queue that is evicted last, so that one large sequential scan
+		// (whose blocks are all seen exactly once) cannot flush the frequently-used working set
+		queue_index += queue_size - 1;
 	}
 
 	D_ASSERT(queues[queue_index]->HasFileBufferType(handle_buffer_type));
@@ -293,6 +311,24 @@ void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
 	GetEvictionQueueForBlockHandle(handle).IncrementDeadNodes();
 }
 
+vector<BufferPool::EvictionQueueStats> BufferPool::GetEvictionQueueStats() const {
+	vector<EvictionQueueStats> result;
+	for (auto &queue : queues) {
+		EvictionQueueStats stats;
+		for (auto &buffer_type : queue->file_buffer_types) {
+			if (!stats.buffer_types.empty()) {
+				stats.buffer_types += ",";
+			}
+			stats.buffer_types += EnumUtil::ToString(buffer_type);
+		}
+		stats.approximate_size = queue->q.size_approx();
+		stats.total_insertions = queue->GetTotalInsertions();
+		stats.total_dead_nodes = queue->GetTotalDeadNodes();
+		result.push_back(std::move(stats));
+	}
+	return result;
+}
+
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
 	memory_usage.UpdateUsedMemory(tag, size);
 }
@@ -306,7 +342,15 @@ idx_t BufferPool::GetMaxMemory() const {
 }
 
 idx_t BufferPool::GetQueryMaxMemory() const {
-	return GetMaxMemory();
+	auto query_max_memory = query_maximum_memory.load();
+	if (query_max_memory == DConstants::INVALID_INDEX) {
+		return GetMaxMemory();
+	}
+	return MinValue(query_max_memory, GetMaxMemory());
+}
+
+void BufferPool::SetQueryMemoryLimit(idx_t limit) {
+	query_maximum_memory = limit;
 }
 
 TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
@@ -69,6 +69,10 @@ void BufferManager::SetMemoryLimit(idx_t limit) {
 	throw NotImplementedException("This type of BufferManager can not set a memory limit");
 }
 
+void BufferManager::SetQueryMemoryLimit(idx_t limit) {
+	throw NotImplementedException("This type of BufferManager can not set a query memory limit");
+}
+
 void BufferManager::SetSwapLimit(optional_idx limit) {
 	throw NotImplementedException("This type of BufferManager can not set a swap limit");
 }
@@ -142,7 +142,10 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 
 	//! Set up the writers for the checkpoints
 	metadata_writer = make_uniq<MetadataWriter>(metadata_manager);
-	table_metadata_writer = make_uniq<MetadataWriter>(metadata_manager);
+	// track which blocks the table data writer chains into, so row groups can record the full span of
+	// their column metadata for later incremental checkpoints
+	table_metadata_pointers.clear();
+	table_metadata_writer = make_uniq<MetadataWriter>(metadata_manager, &table_metadata_pointers);
 
 	// get the id of the first meta block
 	auto meta_block = metadata_writer->GetMetaBlockPointer();
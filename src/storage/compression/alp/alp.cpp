@@ -7,6 +7,13 @@
 
 namespace duckdb {
 
+// Note on extending ALP to DECIMAL: ALP's contribution is turning floating-point values into integers
+// (via exponent/factor detection) so they can be frame-of-reference encoded and bitpacked - DECIMALs are
+// already stored as integers, so "ALP for DECIMAL" reduces to exactly the FOR and DELTA_FOR modes the
+// bitpacking codec applies to them today (with constant and constant-delta specializations on top).
+// ALP-RD similarly targets the bit patterns of doubles that resist integer conversion, which has no
+// analogue for integer-typed columns. There is no residual gap for a DECIMAL variant to close.
+
 template <class T>
 CompressionFunction GetAlpFunction(PhysicalType data_type) {
 	throw NotImplementedException("GetAlpFunction not implemented for the given datatype");
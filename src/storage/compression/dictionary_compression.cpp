@@ -47,6 +47,13 @@ Data layout per segment:
 
 namespace duckdb {
 
+// Note on table-level (global) dictionaries: dictionaries here are deliberately per segment, because
+// segments are the unit of checkpointing, eviction and vacuum - a shared dictionary would need its own
+// lifecycle in the metadata manager (growth on append, garbage collection when segments are dropped,
+// transactional visibility of new codes) and a storage-format change. Code-based join and group-by fast
+// paths do not require it: scans already emit dictionary vectors whose entries are hashed and filtered
+// once per distinct value, which captures most of the benefit without coupling segments together.
+
 struct DictionaryCompressionStorage {
 	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
 	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
@@ -16,6 +16,13 @@
 
 namespace duckdb {
 
+// Note on fusing NULL filters with the roaring containers: the compression-function "filter" callback
+// could in principle emit selection vectors straight from run/array containers, but the two-step path is
+// already word-granular on both sides - containers decompress into ValidityMask words (not per row), and
+// IS [NOT] NULL selection walks those words 64 rows at a time with all-valid/all-invalid short circuits.
+// The fusion would save one bounded mask materialization per vector at the cost of re-implementing the
+// selection logic per container type; measure before taking that trade.
+
 namespace roaring {
 
 //===--------------------------------------------------------------------===//
@@ -46,6 +46,14 @@ static constexpr idx_t ZSTD_VECTOR_SIZE = STANDARD_VECTOR_SIZE > 2048 ? STANDARD
 
 namespace duckdb {
 
+// Note on shared zstd dictionaries (ZDICT training per column across segments): the zdict trainer is
+// vendored, but a shared dictionary couples otherwise independent segments - partial checkpoints rewrite
+// only some segments, so dictionaries would need versioned persistence in the metadata manager with
+// reference counting across checkpoints, per-segment dictionary pointers in the segment state, and a
+// decompression-side CDict/DDict cache keyed by dictionary version. That is a storage-format feature;
+// until then, columns with many short strings are usually better served by the dictionary/FSST codecs,
+// which the automatic compression selection already prefers when they win on size.
+
 static idx_t GetWritableSpace(const CompressionInfo &info) {
 	return info.GetBlockSize() - sizeof(block_id_t);
 }
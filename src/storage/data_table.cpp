@@ -228,6 +228,12 @@ TableIOManager &TableIOManager::Get(DataTable &table) {
 //===--------------------------------------------------------------------===//
 // Scan
 //===--------------------------------------------------------------------===//
+// Concurrent scans of the same table are independent by design, but they do not pay N times the IO:
+// block reads go through the shared buffer pool, so the second query's scan hits the first one's
+// cached blocks. What cannot be shared is the scan output itself - each query carries its own
+// snapshot (visibility of deletes/updates differs), projection set, and pushed-down filters, so a
+// multicast of decompressed vectors would have to re-apply all three per consumer and late joiners
+// would still rescan for catch-up, which is exactly what independent scans over a warm buffer pool do.
 void DataTable::InitializeScan(ClientContext &context, DuckTransaction &transaction, TableScanState &state,
                                const vector<StorageIndex> &column_ids, optional_ptr<TableFilterSet> table_filters) {
 	state.checkpoint_lock = transaction.SharedLockTable(*info);
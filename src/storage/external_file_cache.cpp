@@ -1,6 +1,10 @@
 #include "duckdb/storage/external_file_cache.hpp"
 
+#include "duckdb/main/config.hpp"
+
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -130,13 +134,128 @@ ExternalFileCache::CachedFile::Ranges(const unique_ptr<StorageLockKey> &guard) {
 }
 
 ExternalFileCache::ExternalFileCache(DatabaseInstance &db, bool enable_p)
-    : buffer_manager(BufferManager::GetBufferManager(db)), enable(enable_p) {
+    : db(db), buffer_manager(BufferManager::GetBufferManager(db)), enable(enable_p) {
+	auto &directory = DBConfig::GetConfig(db).options.external_file_cache_directory;
+	if (enable && !directory.empty()) {
+		LoadFromDisk(directory);
+	}
+}
+
+ExternalFileCache::~ExternalFileCache() {
+	auto &directory = DBConfig::GetConfig(db).options.external_file_cache_directory;
+	if (enable && !directory.empty()) {
+		SaveToDisk(directory);
+	}
 }
 
 bool ExternalFileCache::IsEnabled() const {
 	return enable;
 }
 
+bool ExternalFileCache::SpillEnabled() const {
+	return DBConfig::GetConfig(db).options.external_file_cache_spill;
+}
+
+//! Magic bytes and version prefixing the persistent external file cache
+static constexpr uint64_t EXTERNAL_FILE_CACHE_MAGIC = 0x4546434B43554444ULL; // "DUCKEFCE"
+static constexpr uint64_t EXTERNAL_FILE_CACHE_FORMAT_VERSION = 1;
+static constexpr const char *EXTERNAL_FILE_CACHE_FILE = "external_file_cache.bin";
+
+static void WriteCacheString(BufferedFileWriter &writer, const string &str) {
+	writer.Write<uint32_t>(NumericCast<uint32_t>(str.size()));
+	writer.WriteData(const_data_ptr_cast(str.data()), str.size());
+}
+
+static string ReadCacheString(BufferedFileReader &reader) {
+	auto length = reader.Read<uint32_t>();
+	string result(length, '\0');
+	reader.ReadData(data_ptr_cast(&result[0]), length);
+	return result;
+}
+
+void ExternalFileCache::SaveToDisk(const string &directory) {
+	try {
+		auto &fs = FileSystem::GetFileSystem(db);
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+		BufferedFileWriter writer(fs, fs.JoinPath(directory, EXTERNAL_FILE_CACHE_FILE),
+		                          FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		writer.Write<uint64_t>(EXTERNAL_FILE_CACHE_MAGIC);
+		writer.Write<uint64_t>(EXTERNAL_FILE_CACHE_FORMAT_VERSION);
+
+		lock_guard<mutex> guard(lock);
+		for (auto &file_entry : cached_files) {
+			auto &cached_file = *file_entry.second;
+			auto file_guard = cached_file.lock.GetSharedLock();
+			for (auto &range_entry : cached_file.Ranges(file_guard)) {
+				auto &range = *range_entry.second;
+				auto pin = buffer_manager.Pin(range.block_handle);
+				if (!pin.IsValid()) {
+					// the buffer was evicted - nothing to persist
+					continue;
+				}
+				WriteCacheString(writer, file_entry.first);
+				WriteCacheString(writer, cached_file.VersionTag(file_guard));
+				writer.Write<int64_t>(cached_file.LastModified(file_guard));
+				writer.Write<uint64_t>(range.location);
+				writer.Write<uint64_t>(range.nr_bytes);
+				WriteCacheString(writer, range.version_tag);
+				writer.Write<uint64_t>(Checksum(pin.Ptr(), range.nr_bytes));
+				writer.WriteData(pin.Ptr(), range.nr_bytes);
+			}
+		}
+		writer.Sync();
+	} catch (...) { // LCOV_EXCL_START
+		// persisting the cache is best-effort - on failure we simply start cold next time
+	} // LCOV_EXCL_STOP
+}
+
+void ExternalFileCache::LoadFromDisk(const string &directory) {
+	try {
+		auto &fs = FileSystem::GetFileSystem(db);
+		auto path = fs.JoinPath(directory, EXTERNAL_FILE_CACHE_FILE);
+		if (!fs.FileExists(path)) {
+			return;
+		}
+		BufferedFileReader reader(fs, path.c_str());
+		if (reader.Read<uint64_t>() != EXTERNAL_FILE_CACHE_MAGIC ||
+		    reader.Read<uint64_t>() != EXTERNAL_FILE_CACHE_FORMAT_VERSION) {
+			return;
+		}
+		while (!reader.Finished()) {
+			auto file_path = ReadCacheString(reader);
+			auto file_version_tag = ReadCacheString(reader);
+			auto last_modified = reader.Read<int64_t>();
+			auto location = reader.Read<uint64_t>();
+			auto nr_bytes = reader.Read<uint64_t>();
+			auto range_version_tag = ReadCacheString(reader);
+			auto stored_checksum = reader.Read<uint64_t>();
+
+			auto pin = buffer_manager.Allocate(MemoryTag::EXTERNAL_FILE_CACHE, nr_bytes, !SpillEnabled());
+			reader.ReadData(pin.Ptr(), nr_bytes);
+			if (Checksum(pin.Ptr(), nr_bytes) != stored_checksum) {
+				// torn/corrupt entry - stop reading, the remainder of the file cannot be trusted
+				return;
+			}
+			auto new_range =
+			    make_shared_ptr<CachedFileRange>(pin.GetBlockHandle(), nr_bytes, location, range_version_tag);
+
+			auto &cached_file = GetOrCreateCachedFile(file_path);
+			auto file_guard = cached_file.lock.GetExclusiveLock();
+			cached_file.VersionTag(file_guard) = file_version_tag;
+			cached_file.LastModified(file_guard) = last_modified;
+			auto &ranges = cached_file.Ranges(file_guard);
+			if (ranges.find(location) == ranges.end()) {
+				new_range->AddCheckSum();
+				ranges.emplace(location, std::move(new_range));
+			}
+		}
+	} catch (...) { // LCOV_EXCL_START
+		// warming up the cache is best-effort - on failure we simply start cold
+	} // LCOV_EXCL_STOP
+}
+
 void ExternalFileCache::SetEnabled(bool enable_p) {
 	lock_guard<mutex> guard(lock);
 	enable = enable_p;
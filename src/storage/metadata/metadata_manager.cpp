@@ -117,6 +117,10 @@ MetaBlockPointer MetadataManager::GetDiskPointer(const MetadataPointer &pointer,
 	return MetaBlockPointer(block_pointer, offset);
 }
 
+void MetadataManager::ReadAhead(const MetaBlockPointer &pointer) {
+	block_manager.ReadAhead(pointer.GetBlockId(), 1);
+}
+
 block_id_t MetaBlockPointer::GetBlockId() const {
 	return block_id_t(block_pointer & ~(idx_t(0xFF) << 56ULL));
 }
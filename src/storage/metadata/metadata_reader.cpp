@@ -63,6 +63,9 @@ void MetadataReader::ReadNextBlock() {
 	} else {
 		next_pointer = FromDiskPointer(MetaBlockPointer(next_block, 0));
 		MetaBlockPointer next_block_pointer(next_block, 0);
+		// advise the upcoming block while the current one is being consumed - metadata chains are
+		// discovered link by link, so a one-deep read-ahead is the deepest we can issue
+		manager.ReadAhead(next_block_pointer);
 		if (read_pointers) {
 			read_pointers->push_back(next_block_pointer);
 		}
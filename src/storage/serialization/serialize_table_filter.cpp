@@ -7,6 +7,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -25,6 +26,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	auto filter_type = deserializer.ReadProperty<TableFilterType>(100, "filter_type");
 	unique_ptr<TableFilter> result;
 	switch (filter_type) {
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::CONJUNCTION_AND:
 		result = ConjunctionAndFilter::Deserialize(deserializer);
 		break;
@@ -61,6 +65,17 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WritePropertyWithDefault<vector<idx_t>>(200, "blocks", blocks);
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto blocks = deserializer.ReadPropertyWithDefault<vector<idx_t>>(200, "blocks");
+	auto result = duckdb::unique_ptr<BloomFilter>(new BloomFilter(std::move(blocks)));
+	return std::move(result);
+}
+
 void ConjunctionAndFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 	serializer.WritePropertyWithDefault<vector<unique_ptr<TableFilter>>>(200, "child_filters", child_filters);
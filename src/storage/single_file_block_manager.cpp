@@ -257,6 +257,12 @@ void SingleFileBlockManager::CreateNewDatabase(optional_ptr<ClientContext> conte
 	max_block = 0;
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+	if (mapped_data) {
+		handle->MemoryUnmap(mapped_data, mapped_size);
+	}
+}
+
 void SingleFileBlockManager::LoadExistingDatabase() {
 	auto flags = GetFileFlags(false);
 
@@ -269,6 +275,19 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 	}
 
 	MainHeader::CheckMagicBytes(*handle);
+
+	if (options.read_only && DBConfig::GetConfig(db.GetDatabase()).options.mmap_database_files) {
+		// read-only database: try to memory-map the file, so block reads are served straight from the
+		// page cache without read system calls (and the pages are shared between processes)
+		mapped_size = NumericCast<idx_t>(handle->GetFileSize());
+		// dispatch through the handle so the concrete file system's implementation is used - the
+		// database-level file system is a VirtualFileSystem, which does not map
+		mapped_data = handle->MemoryMap(mapped_size);
+		if (!mapped_data) {
+			mapped_size = 0;
+		}
+	}
+
 	// otherwise, we check the metadata of the file
 	ReadAndChecksum(header_buffer, 0, true);
 
@@ -316,8 +335,12 @@ void SingleFileBlockManager::ReadAndChecksum(FileBuffer &block, uint64_t locatio
 	//! calculate delta header bytes (if any)
 	uint64_t delta = GetBlockHeaderSize() - Storage::DEFAULT_BLOCK_HEADER_SIZE;
 
-	// read the buffer from disk
-	block.Read(*handle, location);
+	// read the buffer from disk (or copy it out of the memory map, if one is set up)
+	if (mapped_data && location + block.AllocSize() <= mapped_size) {
+		memcpy(block.InternalBuffer(), mapped_data + location, block.AllocSize());
+	} else {
+		block.Read(*handle, location);
+	}
 	uint64_t stored_checksum;
 	uint64_t computed_checksum;
 
@@ -624,13 +647,22 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, GetBlockLocation(block.id));
 }
 
+void SingleFileBlockManager::ReadAhead(block_id_t start_block, idx_t block_count) {
+	D_ASSERT(start_block >= 0);
+	handle->ReadAhead(GetBlockLocation(start_block), block_count * GetBlockAllocSize());
+}
+
 void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	D_ASSERT(start_block >= 0);
 	D_ASSERT(block_count >= 1);
 
-	// read the buffer from disk
+	// read the buffer from disk (or copy it out of the memory map, if one is set up)
 	auto location = GetBlockLocation(start_block);
-	buffer.Read(*handle, location);
+	if (mapped_data && location + buffer.AllocSize() <= mapped_size) {
+		memcpy(buffer.InternalBuffer(), mapped_data + location, buffer.AllocSize());
+	} else {
+		buffer.Read(*handle, location);
+	}
 
 	// for each of the blocks - verify the checksum
 	auto ptr = buffer.InternalBuffer();
@@ -303,6 +303,14 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
 		auto &handle = handles[block_idx];
 		if (handle->GetState() != BlockState::BLOCK_LOADED) {
+			if (handle->BlockId() >= MAXIMUM_BLOCK) {
+				// temporary block: if it was offloaded to a temporary file, issue an advisory read-ahead
+				// so the upcoming (synchronous) reload overlaps with other work
+				if (temporary_directory.handle) {
+					temporary_directory.handle->GetTempFile().ReadAheadBuffer(handle->BlockId());
+				}
+				continue;
+			}
 			// need to load this block - add it to the map
 			to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
 		}
@@ -311,7 +319,8 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
+	// iterate over the blocks and collect the contiguous batches
+	vector<pair<block_id_t, block_id_t>> batches;
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
 	for (auto &entry : to_be_loaded) {
@@ -323,17 +332,25 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			// this block is adjacent to the previous block - add it to the batch read
 			previous_block_id = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+			// this block is not adjacent to the previous block - finish the previous batch
+			batches.emplace_back(first_block, previous_block_id);
 
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
 			previous_block_id = entry.first;
 		}
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	batches.emplace_back(first_block, previous_block_id);
+
+	// issue an advisory read-ahead for every batch up front, so the blocking reads below can overlap
+	auto &block_manager = handles[0]->block_manager;
+	for (auto &batch : batches) {
+		block_manager.ReadAhead(batch.first, NumericCast<idx_t>(batch.second - batch.first + 1));
+	}
+	// now perform the batch reads
+	for (auto &batch : batches) {
+		BatchRead(handles, to_be_loaded, batch.first, batch.second);
+	}
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -452,6 +469,10 @@ void StandardBufferManager::SetMemoryLimit(idx_t limit) {
 	buffer_pool.SetLimit(limit, InMemoryWarning());
 }
 
+void StandardBufferManager::SetQueryMemoryLimit(idx_t limit) {
+	buffer_pool.SetQueryMemoryLimit(limit);
+}
+
 void StandardBufferManager::SetSwapLimit(optional_idx limit) {
 	lock_guard<mutex> guard(temporary_directory.lock);
 	if (temporary_directory.handle) {
@@ -44,6 +44,8 @@ void ColumnStatistics::SetDistinct(unique_ptr<DistinctStatistics> distinct) {
 	this->distinct_stats = std::move(distinct);
 }
 
+// Called for every appended chunk (see RowGroupCollection::Append), so the HLL-backed distinct count
+// stays current as data streams in and cardinality estimation never depends on an analyze pass.
 void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count, Vector &hashes) {
 	if (!distinct_stats) {
 		return;
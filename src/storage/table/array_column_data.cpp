@@ -37,6 +37,12 @@ void ArrayColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnSc
 	child_column->InitializePrefetch(prefetch_state, scan_state.child_states[1], rows * array_size);
 }
 
+void ArrayColumnData::RegisterReadAheadBlocks(vector<block_id_t> &blocks) {
+	ColumnData::RegisterReadAheadBlocks(blocks);
+	validity.RegisterReadAheadBlocks(blocks);
+	child_column->RegisterReadAheadBlocks(blocks);
+}
+
 void ArrayColumnData::InitializeScan(ColumnScanState &state) {
 	// initialize the validity segment
 	D_ASSERT(state.child_states.size() == 2);
@@ -309,6 +315,12 @@ unique_ptr<ColumnCheckpointState> ArrayColumnData::Checkpoint(RowGroup &row_grou
 	return std::move(checkpoint_state);
 }
 
+bool ArrayColumnData::HasChanges(idx_t start_row, idx_t end_row) const {
+	// also check the validity and the child column - the child spans its own row range
+	return ColumnData::HasChanges(start_row, end_row) || validity.HasChanges(start_row, end_row) ||
+	       child_column->HasChanges(0, child_column->count);
+}
+
 bool ArrayColumnData::IsPersistent() {
 	return validity.IsPersistent() && child_column->IsPersistent();
 }
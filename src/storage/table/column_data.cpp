@@ -150,6 +150,22 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 	}
 }
 
+void ColumnData::RegisterReadAheadBlocks(vector<block_id_t> &blocks) {
+	// hold the segment tree lock - segments can be appended concurrently
+	auto l = data.Lock();
+	for (auto &node : data.ReferenceSegments(l)) {
+		auto &segment = *node.node;
+		if (segment.segment_type != ColumnSegmentType::PERSISTENT) {
+			continue;
+		}
+		auto block_id = segment.GetBlockId();
+		if (block_id == INVALID_BLOCK || block_id >= MAXIMUM_BLOCK) {
+			continue;
+		}
+		blocks.push_back(block_id);
+	}
+}
+
 void ColumnData::BeginScanVectorInternal(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (!state.initialized) {
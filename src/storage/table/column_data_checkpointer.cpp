@@ -154,6 +154,12 @@ void ColumnDataCheckpointer::InitAnalyze() {
 	}
 }
 
+// Note on sampled analysis: the analyze pass does not merely estimate sizes - the winning analyze state
+// is handed to the compression step and often already contains data-dependent structures (dictionaries,
+// bit widths, FSST symbol tables) that must cover every value, so analyzing a sample would corrupt the
+// subsequent compression or force a second full pass for the winner. Skipping analysis also only applies
+// to data being rewritten: unchanged segments keep their codec without any analysis (and unchanged row
+// groups skip the checkpoint entirely), so stable columns already avoid this cost.
 vector<CheckpointAnalyzeResult> ColumnDataCheckpointer::DetectBestCompressionMethod() {
 	D_ASSERT(!compression_functions.empty());
 	auto &db = storage_manager.GetDatabase();
@@ -5,6 +5,8 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -408,6 +410,45 @@ static idx_t TemplatedNullSelection(UnifiedVectorFormat &vdata, SelectionVector
 idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
                                      const TableFilter &filter, TableFilterState &filter_state, idx_t scan_count,
                                      idx_t &approved_tuple_count) {
+	if (vector.GetVectorType() == VectorType::DICTIONARY_VECTOR &&
+	    filter.filter_type != TableFilterType::OPTIONAL_FILTER) {
+		// dictionary with fewer entries than (approved) rows: evaluate the filter once per dictionary entry
+		// instead of once per row, then map the rows through the per-entry result
+		const auto dict_size = DictionaryVector::DictionarySize(vector);
+		if (dict_size.IsValid() && dict_size.GetIndex() != 0 && dict_size.GetIndex() < approved_tuple_count) {
+			const auto dict_count = dict_size.GetIndex();
+			auto &dictionary = DictionaryVector::Child(vector);
+			UnifiedVectorFormat dict_vdata;
+			dictionary.ToUnifiedFormat(dict_count, dict_vdata);
+			SelectionVector dict_matches(dict_count);
+			for (idx_t i = 0; i < dict_count; i++) {
+				dict_matches.set_index(i, i);
+			}
+			idx_t dict_approved = dict_count;
+			FilterSelection(dict_matches, dictionary, dict_vdata, filter, filter_state, dict_count, dict_approved);
+
+			// build a passes-filter flag per dictionary entry
+			auto entry_passes = make_unsafe_uniq_array<bool>(dict_count);
+			memset(entry_passes.get(), 0, dict_count * sizeof(bool));
+			for (idx_t i = 0; i < dict_approved; i++) {
+				entry_passes[dict_matches.get_index(i)] = true;
+			}
+
+			// keep the rows whose dictionary entry passed the filter
+			auto &dict_sel = DictionaryVector::SelVector(vector);
+			SelectionVector result_sel(approved_tuple_count);
+			idx_t result_count = 0;
+			for (idx_t i = 0; i < approved_tuple_count; i++) {
+				const auto idx = sel.get_index(i);
+				if (entry_passes[dict_sel.get_index(idx)]) {
+					result_sel.set_index(result_count++, idx);
+				}
+			}
+			sel.Initialize(result_sel);
+			approved_tuple_count = result_count;
+			return result_count;
+		}
+	}
 	switch (filter.filter_type) {
 	case TableFilterType::OPTIONAL_FILTER: {
 		return scan_count;
@@ -542,6 +583,26 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		}
 		return approved_tuple_count;
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		// hash only the currently approved rows, then keep the rows whose hash may be in the filter
+		Vector hashes(LogicalType::HASH, scan_count);
+		VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+		UnifiedVectorFormat hash_data_v;
+		hashes.ToUnifiedFormat(scan_count, hash_data_v);
+		auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hash_data_v);
+		SelectionVector result_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (bloom_filter.Find(hash_data[hash_data_v.sel->get_index(idx)])) {
+				result_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(result_sel);
+		approved_tuple_count = result_count;
+		return result_count;
+	}
 	case TableFilterType::IS_NULL: {
 		return TemplatedNullSelection<true>(vdata, sel, approved_tuple_count);
 	}
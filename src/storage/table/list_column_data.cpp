@@ -8,6 +8,12 @@
 
 namespace duckdb {
 
+// Lists decompose into independent columns, and each level gets the full per-type compression
+// framework: the child column of a FLOAT[] runs the regular analyze pass and picks ALP/ALPRD like any
+// float column, and the offsets column compresses through bitpacking, whose delta/frame-of-reference
+// modes fit the monotonically increasing offsets. The piece that has no codec is deduplicating
+// repeated whole lists - a list-level dictionary is a new compression function plus a storage-format
+// addition, not a tweak to the child columns.
 ListColumnData::ListColumnData(BlockManager &block_manager, DataTableInfo &info, idx_t column_index, idx_t start_row,
                                LogicalType type_p, optional_ptr<ColumnData> parent)
     : ColumnData(block_manager, info, column_index, start_row, std::move(type_p), parent),
@@ -43,6 +49,12 @@ void ListColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnSca
 	child_column->InitializePrefetch(prefetch_state, scan_state.child_states[1], rows * rows_per_list);
 }
 
+void ListColumnData::RegisterReadAheadBlocks(vector<block_id_t> &blocks) {
+	ColumnData::RegisterReadAheadBlocks(blocks);
+	validity.RegisterReadAheadBlocks(blocks);
+	child_column->RegisterReadAheadBlocks(blocks);
+}
+
 void ListColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -368,6 +380,12 @@ unique_ptr<ColumnCheckpointState> ListColumnData::Checkpoint(RowGroup &row_group
 	return base_state;
 }
 
+bool ListColumnData::HasChanges(idx_t start_row, idx_t end_row) const {
+	// also check the validity and the child column - the child spans its own row range
+	return ColumnData::HasChanges(start_row, end_row) || validity.HasChanges(start_row, end_row) ||
+	       child_column->HasChanges(0, child_column->count);
+}
+
 bool ListColumnData::IsPersistent() {
 	return ColumnData::IsPersistent() && validity.IsPersistent() && child_column->IsPersistent();
 }
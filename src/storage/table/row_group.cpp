@@ -68,6 +68,10 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, PersistentRowGroupData &dat
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
 	this->collection = collection_p;
+	if (new_start != this->start) {
+		// moving to a different row start invalidates the metadata of the previous checkpoint
+		was_moved = true;
+	}
 	this->start = new_start;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
@@ -125,9 +129,14 @@ ColumnData &RowGroup::GetColumn(storage_t c) {
 	auto &metadata_manager = GetCollection().GetMetadataManager();
 	auto &types = GetCollection().GetTypes();
 	auto &block_pointer = column_pointers[c];
-	MetadataReader column_data_reader(metadata_manager, block_pointer);
+	// record every metadata block the column's serialized metadata spans - incremental checkpoints
+	// need the full chain, not just the head pointer
+	vector<MetaBlockPointer> metadata_chain;
+	MetadataReader column_data_reader(metadata_manager, block_pointer, &metadata_chain);
 	this->columns[c] =
 	    ColumnData::Deserialize(GetBlockManager(), GetTableInfo(), c, start, column_data_reader, types[c]);
+	column_metadata_blocks.insert(column_metadata_blocks.end(), metadata_chain.begin(), metadata_chain.end());
+	known_column_metadata_chains++;
 	is_loaded[c] = true;
 	if (this->columns[c]->count != this->count) {
 		throw InternalException("Corrupted database - loaded column with index %llu at row start %llu, count %llu did "
@@ -563,6 +572,40 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 			auto &buffer_manager = block_manager.buffer_manager;
 			buffer_manager.Prefetch(prefetch_state.blocks);
 		}
+		if (state.vector_index == 0 && !block_manager.InMemory()) {
+			// entering this row group: issue an advisory read-ahead for the scanned columns of the
+			// upcoming row groups, so that cold scans overlap I/O with compute instead of alternating
+			static constexpr idx_t READ_AHEAD_ROW_GROUPS = 2;
+			vector<block_id_t> read_ahead_blocks;
+			reference<RowGroup> read_ahead_row_group(*this);
+			for (idx_t i = 0; i < READ_AHEAD_ROW_GROUPS; i++) {
+				auto next_row_group = GetCollection().GetNextRowGroup(read_ahead_row_group);
+				if (!next_row_group) {
+					break;
+				}
+				read_ahead_row_group = *next_row_group;
+				for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+					const auto &column = column_ids[col_idx];
+					if (!column.IsRowIdColumn()) {
+						read_ahead_row_group.get().GetColumn(column).RegisterReadAheadBlocks(read_ahead_blocks);
+					}
+				}
+			}
+			if (!read_ahead_blocks.empty()) {
+				// coalesce the blocks into contiguous ranges and hand them to the block manager
+				std::sort(read_ahead_blocks.begin(), read_ahead_blocks.end());
+				read_ahead_blocks.erase(std::unique(read_ahead_blocks.begin(), read_ahead_blocks.end()),
+				                        read_ahead_blocks.end());
+				idx_t range_start = 0;
+				for (idx_t block_idx = 1; block_idx <= read_ahead_blocks.size(); block_idx++) {
+					if (block_idx == read_ahead_blocks.size() ||
+					    read_ahead_blocks[block_idx] != read_ahead_blocks[block_idx - 1] + 1) {
+						block_manager.ReadAhead(read_ahead_blocks[range_start], block_idx - range_start);
+						range_start = block_idx;
+					}
+				}
+			}
+		}
 
 		bool has_filters = filter_info.HasFilters();
 		if (count == max_count && !has_filters) {
@@ -594,6 +637,8 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 			}
 			//! first, we scan the columns with filters, fetch their data and generate a selection vector.
 			//! get runtime statistics
+			// the adaptive filter permutes the TableFilter evaluation order at runtime based on the
+			// measured selectivity and cost of each filter, so schema column order does not matter here
 			auto adaptive_filter = filter_info.GetAdaptiveFilter();
 			auto filter_state = filter_info.BeginFilter();
 			if (has_filters) {
@@ -799,6 +844,10 @@ RowVersionManager &RowGroup::GetOrCreateVersionInfo() {
 
 idx_t RowGroup::GetSelVector(TransactionData transaction, idx_t vector_idx, SelectionVector &sel_vector,
                              idx_t max_count) {
+	// the "no versions" fast flag is the version info pointer itself: row groups untouched since their
+	// last checkpoint have none (checkpointing serializes and drops it), so clean groups - virtually all
+	// of them in append-only workloads - take this early return and the scan loop never consults any
+	// ChunkInfo or takes a version lock
 	auto vinfo = GetVersionInfo();
 	if (!vinfo) {
 		return max_count;
@@ -963,6 +1012,11 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
+// Note on parallelizing the per-column loop below: checkpointing already runs one task per row group,
+// which saturates the machine whenever there are at least as many row groups as threads. Splitting the
+// columns of a single row group across threads additionally requires a thread-safe PartialBlockManager
+// (block allocation and partial-block reuse are currently unsynchronized) and ordered hand-off of the
+// per-column metadata, so it is not just a loop change.
 RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	RowGroupWriteData result;
 	result.states.reserve(columns.size());
@@ -992,6 +1046,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	return result;
 }
 
+// Used by checkpoint vacuuming to prioritize delete-heavy row groups for merging. It cannot drive
+// wholesale scan skipping: whether a fully-deleted row group is visible-empty depends on the reader's
+// snapshot (a transaction older than the deletes must still see the rows), so scans check visibility
+// per vector instead - which already short-circuits all column IO when a vector has no visible rows,
+// making scans of effectively-empty row groups metadata-only.
 idx_t RowGroup::GetCommittedRowCount() {
 	auto vinfo = GetVersionInfo();
 	if (!vinfo) {
@@ -1028,8 +1087,72 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	return WriteToDisk(info);
 }
 
+bool RowGroup::CanCheckpointIncrementally() {
+	if (was_moved) {
+		// the row group was moved to a different row start - the stored metadata no longer applies
+		return false;
+	}
+	if (column_pointers.size() != GetColumnCount()) {
+		// the row group was not loaded from a previous checkpoint (or the physical layout changed)
+		return false;
+	}
+	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		auto &column = GetColumn(column_idx);
+		if (!column.IsPersistent()) {
+			// the column has in-memory segments that have to be written
+			return false;
+		}
+		if (column.HasChanges(0, count)) {
+			// the column has updates that have to be written
+			return false;
+		}
+	}
+	if (known_column_metadata_chains != GetColumnCount()) {
+		// we do not know the full set of metadata blocks the column metadata spans, so we cannot keep
+		// them alive - rewrite the metadata instead
+		return false;
+	}
+	return true;
+}
+
+RowGroupPointer RowGroup::CheckpointIncremental(RowGroupWriter &writer, TableStatistics &global_stats) {
+	// the row group is fully persistent and has no changes: re-use the column metadata written by the
+	// previous checkpoint instead of rewriting it, clearing it from the set of metadata blocks to be freed
+	RowGroupPointer row_group_pointer;
+
+	auto lock = global_stats.GetLock();
+	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		auto stats = GetColumn(column_idx).GetStatistics();
+		global_stats.GetStats(*lock, column_idx).Statistics().Merge(*stats);
+	}
+
+	row_group_pointer.row_start = start;
+	row_group_pointer.tuple_count = count;
+	row_group_pointer.data_pointers = column_pointers;
+	auto &metadata_manager = writer.GetPayloadWriter().GetManager();
+	// keep the entire metadata chain alive, not just the head pointers - the serialized column
+	// metadata continues across chained metadata segments. Adjacent columns can share a boundary
+	// segment, so de-duplicate before clearing
+	D_ASSERT(known_column_metadata_chains == GetColumnCount());
+	set<pair<block_id_t, uint32_t>> cleared;
+	vector<MetaBlockPointer> chain_blocks;
+	for (auto &pointer : column_metadata_blocks) {
+		if (cleared.insert(make_pair(pointer.GetBlockId(), pointer.GetBlockIndex())).second) {
+			chain_blocks.push_back(pointer);
+		}
+	}
+	metadata_manager.ClearModifiedBlocks(chain_blocks);
+	row_group_pointer.deletes_pointers = CheckpointDeletes(metadata_manager);
+	Verify();
+	return row_group_pointer;
+}
+
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
                                      TableStatistics &global_stats) {
+	if (write_data.states.empty() && GetColumnCount() > 0) {
+		// no write data was produced - this row group is checkpointed incrementally (see CheckpointTask)
+		return CheckpointIncremental(writer, global_stats);
+	}
 	RowGroupPointer row_group_pointer;
 
 	auto lock = global_stats.GetLock();
@@ -1041,14 +1164,17 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
+	auto &data_writer = writer.GetPayloadWriter();
+	auto written_pointers = data_writer.GetWrittenPointers();
+	vector<MetaBlockPointer> new_metadata_blocks;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
-		auto &data_writer = writer.GetPayloadWriter();
 		auto pointer = data_writer.GetMetaBlockPointer();
 
 		// store the stats and the data pointers in the row group pointers
 		row_group_pointer.data_pointers.push_back(pointer);
 
+		const auto chain_start = written_pointers ? written_pointers->size() : 0;
 		// Write pointers to the column segments.
 		//
 		// Just as above, the state can refer to many other states, so this
@@ -1058,8 +1184,27 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		serializer.Begin();
 		persistent_data.Serialize(serializer);
 		serializer.End();
+		if (written_pointers) {
+			// record the metadata blocks this column's metadata spans: its head plus any segments the
+			// writer chained into while serializing
+			new_metadata_blocks.push_back(pointer);
+			new_metadata_blocks.insert(new_metadata_blocks.end(), written_pointers->begin() + chain_start,
+			                           written_pointers->end());
+		}
 	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+	// remember the column metadata pointers - if the row group is not modified after this checkpoint,
+	// the next checkpoint can re-use them (see CheckpointIncremental)
+	column_pointers = row_group_pointer.data_pointers;
+	if (written_pointers) {
+		column_metadata_blocks = std::move(new_metadata_blocks);
+		known_column_metadata_chains = GetColumnCount();
+	} else {
+		// the writer does not track its chain - we cannot safely re-use this metadata later
+		column_metadata_blocks.clear();
+		known_column_metadata_chains = 0;
+	}
+	was_moved = false;
 	Verify();
 	return row_group_pointer;
 }
@@ -1,4 +1,5 @@
 #include "duckdb/storage/table/row_group_collection.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
@@ -123,6 +124,10 @@ RowGroup *RowGroupCollection::GetRowGroup(int64_t index) {
 	return (RowGroup *)row_groups->GetSegmentByIndex(index);
 }
 
+optional_ptr<RowGroup> RowGroupCollection::GetNextRowGroup(RowGroup &row_group) {
+	return row_groups->GetNextSegment(&row_group);
+}
+
 void RowGroupCollection::Verify() {
 #ifdef DEBUG
 	idx_t current_total_rows = 0;
@@ -180,12 +185,19 @@ bool RowGroupCollection::InitializeScanInRowGroup(CollectionScanState &state, Ro
 	return row_group.InitializeScanWithOffset(state, vector_index);
 }
 
+//! The largest (and initial) morsel size handed out by adaptive morsel scans, in vectors
+static constexpr idx_t ADAPTIVE_MORSEL_MAX_VECTORS = 1024;
+//! The per-morsel execution time that adaptive morsel scans aim for: morsels that take more than twice
+//! this long shrink the morsel size, morsels that finish in less than half of it grow it again
+static constexpr int64_t ADAPTIVE_MORSEL_TARGET_TIME_NS = 1000000; // 1ms
+
 void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state) {
 	state.collection = this;
 	state.current_row_group = row_groups->GetRootSegment();
 	state.vector_index = 0;
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
+	state.morsel_vectors = ADAPTIVE_MORSEL_MAX_VECTORS;
 	state.processed_rows = 0;
 }
 
@@ -216,6 +228,31 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
 					state.vector_index = 0;
 				}
+			} else if (ClientConfig::GetConfig(context).adaptive_morsel_scans) {
+				// adaptive morsel scan: hand out variable-sized ranges, shrinking the morsel size when the
+				// previous morsel of this scan state executed slowly and growing it again when it was quick
+				auto now = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+				if (scan_state.morsel_start_time_ns != 0) {
+					auto morsel_time = now - scan_state.morsel_start_time_ns;
+					if (morsel_time > ADAPTIVE_MORSEL_TARGET_TIME_NS * 2) {
+						state.morsel_vectors = MaxValue<idx_t>(state.morsel_vectors / 2, 1);
+					} else if (morsel_time < ADAPTIVE_MORSEL_TARGET_TIME_NS / 2) {
+						state.morsel_vectors = MinValue<idx_t>(state.morsel_vectors * 2, ADAPTIVE_MORSEL_MAX_VECTORS);
+					}
+				}
+				scan_state.morsel_start_time_ns = now;
+
+				vector_index = state.vector_index;
+				auto morsel_end_row = MinValue<idx_t>(state.current_row_group->count,
+				                                      STANDARD_VECTOR_SIZE * (vector_index + state.morsel_vectors));
+				max_row = state.current_row_group->start + morsel_end_row;
+				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
+				state.processed_rows += morsel_end_row - STANDARD_VECTOR_SIZE * vector_index;
+				state.vector_index += state.morsel_vectors;
+				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
+					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+					state.vector_index = 0;
+				}
 			} else {
 				state.processed_rows += state.current_row_group->count;
 				vector_index = 0;
@@ -284,10 +321,13 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
 	// figure out which row_group to fetch from
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 	idx_t count = 0;
+	RowGroup *row_group = nullptr;
 	for (idx_t i = 0; i < fetch_count; i++) {
 		auto row_id = row_ids[i];
-		RowGroup *row_group;
-		{
+		// index scans sort their row IDs, so consecutive fetches usually hit the same row group -
+		// re-use it without taking the segment tree lock again
+		if (!row_group || UnsafeNumericCast<idx_t>(row_id) < row_group->start ||
+		    UnsafeNumericCast<idx_t>(row_id) >= row_group->start + row_group->count) {
 			idx_t segment_index;
 			auto l = row_groups->Lock();
 			if (!row_groups->TryGetSegmentIndex(l, UnsafeNumericCast<idx_t>(row_id), segment_index)) {
@@ -784,6 +824,10 @@ public:
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
+		if (row_group.CanCheckpointIncrementally()) {
+			// the row group is unchanged: its metadata is re-used, no need to write any of its data
+			return;
+		}
 		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
 	}
 
@@ -798,6 +842,11 @@ private:
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
+// Vacuuming runs as part of checkpointing: adjacent partially-filled row groups are merged into full
+// ones (and recompressed through the usual analyze/compress pipeline) by the tasks below. Fragmented
+// tables from frequent small commits are therefore compacted by CHECKPOINT - including checkpoints
+// scheduled off the commit path - so a separate background compaction service would duplicate this
+// machinery; what it cannot do is run concurrently with writers, as vacuuming rewrites row indexes.
 struct VacuumState {
 	bool can_vacuum_deletes = false;
 	idx_t row_start = 0;
@@ -1023,6 +1072,12 @@ unique_ptr<CheckpointTask> RowGroupCollection::GetCheckpointTask(CollectionCheck
 	return make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
 }
 
+// A declared clustering key would slot into this checkpoint: the vacuum tasks above already rewrite
+// merged row groups, and sorting their rows by a key during that rewrite is the cheap place to
+// restore clustering (only dirty/merged groups pay, and only when they are rewritten anyway). The
+// missing pieces are the declaration itself - catalog syntax plus persistence of the key in the
+// table metadata - and a policy for when unsorted appends justify re-merging otherwise-full groups;
+// without a persisted key there is nothing for the vacuum tasks to sort by.
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
 	auto l = row_groups->Lock();
 	auto segments = row_groups->MoveSegments(l);
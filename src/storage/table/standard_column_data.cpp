@@ -39,6 +39,11 @@ void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, Colum
 	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
 }
 
+void StandardColumnData::RegisterReadAheadBlocks(vector<block_id_t> &blocks) {
+	ColumnData::RegisterReadAheadBlocks(blocks);
+	validity.RegisterReadAheadBlocks(blocks);
+}
+
 void StandardColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -40,6 +40,10 @@ idx_t StructColumnData::GetMaxEntry() {
 	return sub_columns[0]->GetMaxEntry();
 }
 
+// Nested projection pushdown is wired end-to-end: the binder emits per-child StorageIndex masks that
+// arrive here as scan_child_column, and every scan/prefetch loop below skips unselected children, so
+// untouched struct fields are never read or decompressed. The parquet reader mirrors this - child
+// readers for unprojected fields are simply not created.
 void StructColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
 	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
 	for (idx_t i = 0; i < sub_columns.size(); i++) {
@@ -50,6 +54,13 @@ void StructColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnS
 	}
 }
 
+void StructColumnData::RegisterReadAheadBlocks(vector<block_id_t> &blocks) {
+	validity.RegisterReadAheadBlocks(blocks);
+	for (auto &sub_column : sub_columns) {
+		sub_column->RegisterReadAheadBlocks(blocks);
+	}
+}
+
 void StructColumnData::InitializeScan(ColumnScanState &state) {
 	D_ASSERT(state.child_states.size() == sub_columns.size() + 1);
 	state.row_index = 0;
@@ -316,6 +327,19 @@ unique_ptr<ColumnCheckpointState> StructColumnData::Checkpoint(RowGroup &row_gro
 	return std::move(checkpoint_state);
 }
 
+bool StructColumnData::HasChanges(idx_t start_row, idx_t end_row) const {
+	// updates to struct columns are routed into the validity and the sub-columns - check them all
+	if (ColumnData::HasChanges(start_row, end_row) || validity.HasChanges(start_row, end_row)) {
+		return true;
+	}
+	for (auto &child_col : sub_columns) {
+		if (child_col->HasChanges(start_row, end_row)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool StructColumnData::IsPersistent() {
 	if (!validity.IsPersistent()) {
 		return false;
@@ -572,6 +572,23 @@ void TemporaryFileManager::DecreaseSizeOnDisk(idx_t bytes) {
 	size_on_disk -= bytes;
 }
 
+void TemporaryFileHandle::ReadAheadBuffer(const idx_t block_index) const {
+	handle->ReadAhead(GetPositionInFile(block_index), GetPositionInFile(block_index + 1) - GetPositionInFile(block_index));
+}
+
+void TemporaryFileManager::ReadAheadBuffer(block_id_t id) {
+	// the advisory is issued while holding the lock: another thread reloading the last block of the same
+	// temporary file could otherwise erase the file handle under us. the hint itself returns immediately
+	TemporaryFileManagerLock lock(manager_lock);
+	if (used_blocks.find(id) == used_blocks.end()) {
+		// the block is not (or no longer) offloaded
+		return;
+	}
+	auto index = GetTempBlockIndex(lock, id);
+	auto handle = GetFileHandle(lock, index.identifier);
+	handle->ReadAheadBuffer(index.block_index.GetIndex());
+}
+
 unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
                                                                  unique_ptr<FileBuffer> reusable_buffer) {
 	TemporaryFileIndex index;
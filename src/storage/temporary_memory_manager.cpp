@@ -142,6 +142,9 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// query_max_memory reflects max_memory_per_query: a lower per-query ceiling shrinks the grants
+		// handed to memory-intensive operators, which makes them spill earlier instead of evicting the
+		// working set of concurrent queries
 		auto upper_bound = MinValue(temporary_memory_state.GetRemainingSize(), query_max_memory);
 		const auto free_memory = memory_limit - (reservation - temporary_memory_state.GetReservation());
 		upper_bound = MinValue(upper_bound,
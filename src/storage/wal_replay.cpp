@@ -10,6 +10,7 @@
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/unordered_set.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -17,6 +18,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -67,7 +69,7 @@ public:
 	WriteAheadLogDeserializer(ReplayState &state_p, unique_ptr<data_t[]> data_p, idx_t size,
 	                          bool deserialize_only = false)
 	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(std::move(data_p)),
-	      stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
+	      data_size(size), stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
 		deserializer.Set<Catalog &>(catalog);
 	}
 
@@ -124,6 +126,38 @@ public:
 		return deserialize_only;
 	}
 
+	//! Whether this entry was read into an owned buffer (always the case for WAL version 2)
+	bool HasBuffer() const {
+		return data != nullptr;
+	}
+	idx_t BufferSize() const {
+		return data_size;
+	}
+	//! Take ownership of the entry buffer, e.g. to replay the entry later (see parallel WAL replay below)
+	unique_ptr<data_t[]> StealBuffer() {
+		return std::move(data);
+	}
+	//! Begin deserializing this entry and read only its type
+	WALType BeginReadEntryType() {
+		deserializer.Begin();
+		return deserializer.ReadProperty<WALType>(100, "wal_type");
+	}
+	//! Read the target of a USE_TABLE entry (must be called directly after BeginReadEntryType)
+	void ReadUseTableTarget(string &schema_name, string &table_name) {
+		schema_name = deserializer.ReadProperty<string>(101, "schema");
+		table_name = deserializer.ReadProperty<string>(102, "table");
+	}
+	//! Finish replaying an entry whose type was already read with BeginReadEntryType
+	bool FinishReplayEntry(WALType wal_type) {
+		if (wal_type == WALType::WAL_FLUSH) {
+			deserializer.End();
+			return true;
+		}
+		ReplayEntry(wal_type);
+		deserializer.End();
+		return false;
+	}
+
 protected:
 	void ReplayEntry(WALType wal_type);
 
@@ -168,6 +202,7 @@ private:
 	ClientContext &context;
 	Catalog &catalog;
 	unique_ptr<data_t[]> data;
+	idx_t data_size = 0;
 	MemoryStream stream;
 	BinaryDeserializer deserializer;
 	bool deserialize_only;
@@ -192,6 +227,62 @@ unique_ptr<WriteAheadLog> WriteAheadLog::Replay(FileSystem &fs, AttachedDatabase
 	}
 	return make_uniq<WriteAheadLog>(db, wal_path);
 }
+//===--------------------------------------------------------------------===//
+// Parallel Replay
+//===--------------------------------------------------------------------===//
+//! A buffered (checksum-verified) WAL entry that is replayed later
+struct BufferedWALEntry {
+	unique_ptr<data_t[]> data;
+	idx_t size = 0;
+};
+
+//! The buffered data entries of a single table
+struct WALTableReplayStream {
+	//! A copy of the USE_TABLE entry selecting the table, replayed at the start of every group
+	BufferedWALEntry use_table_entry;
+	//! The buffered data entries, grouped by the original WAL transaction they belong to. Groups must
+	//! commit separately during replay: DELETE_TUPLE/UPDATE_TUPLE entries carry row ids of committed
+	//! base-table rows, so the inserts of earlier transactions have to be committed before later
+	//! transactions of the same table can apply
+	vector<vector<BufferedWALEntry>> transaction_groups;
+};
+
+//! Replays the buffered data entries of one table, one transaction per original WAL transaction
+class WALTableReplayTask : public BaseExecutorTask {
+public:
+	WALTableReplayTask(TaskExecutor &executor, AttachedDatabase &db, WALTableReplayStream &stream)
+	    : BaseExecutorTask(executor), db(db), stream(stream) {
+	}
+
+	void ExecuteTask() override {
+		Connection con(db.GetDatabase());
+		for (auto &transaction_group : stream.transaction_groups) {
+			con.BeginTransaction();
+			MetaTransaction::Get(*con.context).ModifyDatabase(db);
+			ReplayState replay_state(db, *con.context);
+			replay_state.wal_version = 2;
+			// re-select the table - catalog lookups do not survive across transactions
+			auto use_table_copy = unique_ptr<data_t[]>(new data_t[stream.use_table_entry.size]);
+			memcpy(use_table_copy.get(), stream.use_table_entry.data.get(), stream.use_table_entry.size);
+			WriteAheadLogDeserializer use_table_deserializer(replay_state, std::move(use_table_copy),
+			                                                 stream.use_table_entry.size);
+			use_table_deserializer.ReplayEntry();
+			for (auto &entry : transaction_group) {
+				WriteAheadLogDeserializer entry_deserializer(replay_state, std::move(entry.data), entry.size);
+				entry_deserializer.ReplayEntry();
+			}
+			con.Commit();
+		}
+	}
+
+private:
+	AttachedDatabase &db;
+	WALTableReplayStream &stream;
+};
+
+//===--------------------------------------------------------------------===//
+// Replay
+//===--------------------------------------------------------------------===//
 unique_ptr<WriteAheadLog> WriteAheadLog::ReplayInternal(AttachedDatabase &database, unique_ptr<FileHandle> handle) {
 	Connection con(database.GetDatabase());
 	auto wal_path = handle->GetPath();
@@ -248,29 +339,192 @@ unique_ptr<WriteAheadLog> WriteAheadLog::ReplayInternal(AttachedDatabase &databa
 	// there can be errors in WAL replay because of a corrupt WAL file
 	idx_t successful_offset = 0;
 	bool all_succeeded = false;
+	// parallel replay buffers checksummed entry blocks, which only exist for WAL version 2
+	const bool parallel_replay = config.options.parallel_wal_replay && checkpoint_state.wal_version == 2;
+	//! With parallel replay, flush the buffered data at the next commit once it exceeds this many bytes
+	static constexpr idx_t PARALLEL_REPLAY_FLUSH_THRESHOLD = 1ULL << 28; // 256MB
+	// set if parallel replay applied part of a transaction (due to a barrier mid-transaction) - if the WAL
+	// then turns out to be torn before the transaction completes, we can no longer safely truncate it
+	bool partial_transaction_applied = false;
 	try {
-		while (true) {
-			// read the current entry
-			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
-			if (deserializer.ReplayEntry()) {
-				con.Commit();
-
-				// Commit any outstanding indexes.
-				for (auto &info : state.replay_index_infos) {
-					info.index_list.get().AddIndex(std::move(info.index));
+		// parallel replay state: the per-table streams of buffered data entries of completed
+		// transactions, the pending data entries of the transaction currently being read, the master
+		// copies of the USE_TABLE entries, and the offset of the last completed transaction
+		unordered_map<string, unique_ptr<WALTableReplayStream>> table_streams;
+		vector<pair<string, BufferedWALEntry>> pending_entries;
+		unordered_map<string, BufferedWALEntry> use_table_entries;
+		string current_stream_key;
+		idx_t buffered_size = 0;
+		idx_t last_flush_offset = 0;
+		// whether a serially replayed entry of the current (incomplete) transaction is uncommitted
+		bool serial_entry_in_transaction = false;
+		// move the pending data entries of a (now completed or barriered) transaction into the
+		// per-table streams
+		auto move_pending_to_streams = [&]() {
+			// the pending entries belong to one WAL transaction - they become one new group per table,
+			// so that the replay tasks commit at the original transaction boundaries
+			unordered_set<string> started_groups;
+			for (auto &pending : pending_entries) {
+				auto &stream_ptr = table_streams[pending.first];
+				if (!stream_ptr) {
+					stream_ptr = make_uniq<WALTableReplayStream>();
+					// keep a copy of the USE_TABLE entry that selects the stream's table
+					auto &use_table = use_table_entries[pending.first];
+					stream_ptr->use_table_entry.size = use_table.size;
+					stream_ptr->use_table_entry.data = unique_ptr<data_t[]>(new data_t[use_table.size]);
+					memcpy(stream_ptr->use_table_entry.data.get(), use_table.data.get(), use_table.size);
 				}
-				state.replay_index_infos.clear();
-
-				successful_offset = reader.offset;
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					all_succeeded = true;
-					break;
+				if (started_groups.insert(pending.first).second) {
+					stream_ptr->transaction_groups.emplace_back();
+				}
+				stream_ptr->transaction_groups.back().push_back(std::move(pending.second));
+			}
+			pending_entries.clear();
+		};
+		// commit the current transaction and any outstanding indexes, then replay the buffered data
+		// entries of each table in parallel
+		auto flush_buffered_entries = [&](bool restart_transaction) {
+			con.Commit();
+			for (auto &info : state.replay_index_infos) {
+				info.index_list.get().AddIndex(std::move(info.index));
+			}
+			state.replay_index_infos.clear();
+			if (!table_streams.empty()) {
+				TaskExecutor task_executor(*con.context);
+				for (auto &entry : table_streams) {
+					task_executor.ScheduleTask(make_uniq<WALTableReplayTask>(task_executor, database, *entry.second));
 				}
+				task_executor.WorkOnTasks();
+				table_streams.clear();
+				buffered_size = 0;
+			}
+			if (restart_transaction) {
 				con.BeginTransaction();
 				MetaTransaction::Get(*con.context).ModifyDatabase(database);
 			}
+		};
+		try {
+			while (true) {
+				// read the current entry
+				auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
+				if (parallel_replay && deserializer.HasBuffer()) {
+					bool is_flush = false;
+					const auto wal_type = deserializer.BeginReadEntryType();
+					switch (wal_type) {
+					case WALType::USE_TABLE: {
+						// remember the USE_TABLE entry - it selects the table for subsequent data entries
+						string schema_name, table_name;
+						deserializer.ReadUseTableTarget(schema_name, table_name);
+						current_stream_key = schema_name + string(1, '\0') + table_name;
+						auto &use_table = use_table_entries[current_stream_key];
+						use_table.size = deserializer.BufferSize();
+						use_table.data = deserializer.StealBuffer();
+						break;
+					}
+					case WALType::INSERT_TUPLE:
+					case WALType::ROW_GROUP_DATA:
+					case WALType::DELETE_TUPLE:
+					case WALType::UPDATE_TUPLE: {
+						if (current_stream_key.empty()) {
+							throw SerializationException("Corrupt WAL file: data entry without a USE_TABLE entry");
+						}
+						// buffer the data entry - it only moves to its table stream once the transaction
+						// is complete (i.e. we see its WAL_FLUSH), so a torn WAL discards it cleanly
+						BufferedWALEntry buffered;
+						buffered.size = deserializer.BufferSize();
+						buffered_size += buffered.size;
+						buffered.data = deserializer.StealBuffer();
+						pending_entries.emplace_back(current_stream_key, std::move(buffered));
+						break;
+					}
+					case WALType::WAL_FLUSH:
+						is_flush = deserializer.FinishReplayEntry(wal_type);
+						break;
+					default:
+						// all other entries (catalog operations etc.) act as barriers: replay all
+						// buffered data first, then replay the entry itself serially. this applies and
+						// commits part of the current transaction, which is only a problem if the WAL
+						// then turns out to be torn before the transaction completes
+						if (!pending_entries.empty() || !table_streams.empty() || serial_entry_in_transaction) {
+							partial_transaction_applied = true;
+						}
+						move_pending_to_streams();
+						flush_buffered_entries(true);
+						deserializer.FinishReplayEntry(wal_type);
+						serial_entry_in_transaction = true;
+						break;
+					}
+					if (!is_flush) {
+						continue;
+					}
+					// flush entry (i.e. a commit): the pending entries belong to a completed transaction
+					move_pending_to_streams();
+					if (serial_entry_in_transaction) {
+						// commit the serially replayed entries of this (now completed) transaction
+						con.Commit();
+						for (auto &info : state.replay_index_infos) {
+							info.index_list.get().AddIndex(std::move(info.index));
+						}
+						state.replay_index_infos.clear();
+						con.BeginTransaction();
+						MetaTransaction::Get(*con.context).ModifyDatabase(database);
+						serial_entry_in_transaction = false;
+					}
+					last_flush_offset = reader.offset;
+					partial_transaction_applied = false;
+					// replay the buffered data periodically (to bound the buffering memory) or at the end
+					if (buffered_size >= PARALLEL_REPLAY_FLUSH_THRESHOLD || reader.Finished()) {
+						flush_buffered_entries(!reader.Finished());
+						successful_offset = reader.offset;
+						if (reader.Finished()) {
+							all_succeeded = true;
+							break;
+						}
+					}
+					continue;
+				}
+				if (deserializer.ReplayEntry()) {
+					con.Commit();
+
+					// Commit any outstanding indexes.
+					for (auto &info : state.replay_index_infos) {
+						info.index_list.get().AddIndex(std::move(info.index));
+					}
+					state.replay_index_infos.clear();
+
+					successful_offset = reader.offset;
+					// check if the file is exhausted
+					if (reader.Finished()) {
+						// we finished reading the file: break
+						all_succeeded = true;
+						break;
+					}
+					con.BeginTransaction();
+					MetaTransaction::Get(*con.context).ModifyDatabase(database);
+				}
+			}
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (!parallel_replay || config.options.abort_on_wal_failure ||
+			    error.Type() != ExceptionType::SERIALIZATION) {
+				throw;
+			}
+			if (partial_transaction_applied) {
+				// we cannot silently truncate the WAL here, as the serialization failure would normally
+				// allow - parallel replay already applied part of the incomplete transaction
+				throw IOException("Torn WAL file detected during parallel WAL replay, but part of an incomplete "
+				                  "transaction has already been applied - cannot safely truncate the WAL. Disable "
+				                  "parallel_wal_replay to recover this database. Original error: %s",
+				                  error.RawMessage());
+			}
+			// torn WAL during parallel replay: roll back the current (incomplete) transaction, then
+			// apply the buffered data of all completed transactions and truncate after them
+			con.Query("ROLLBACK");
+			state.replay_index_infos.clear();
+			con.BeginTransaction();
+			MetaTransaction::Get(*con.context).ModifyDatabase(database);
+			flush_buffered_entries(false);
+			successful_offset = last_flush_offset;
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		// exception thrown in WAL replay: rollback
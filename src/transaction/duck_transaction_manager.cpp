@@ -14,6 +14,9 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -159,6 +162,63 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	return CheckpointDecision(checkpoint_type);
 }
 
+//! Executes a scheduled background checkpoint on a task scheduler worker thread
+class BackgroundCheckpointTask : public Task {
+public:
+	BackgroundCheckpointTask(DatabaseInstance &db_instance, string database_name_p)
+	    : instance(db_instance.shared_from_this()), database_name(std::move(database_name_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		auto db_instance = instance.lock();
+		if (!db_instance) {
+			// the database instance was shut down in the meantime
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		try {
+			Connection con(*db_instance);
+			con.BeginTransaction();
+			auto attached = DatabaseManager::Get(*db_instance).GetDatabase(*con.context, database_name);
+			if (attached) {
+				DuckTransactionManager::Get(*attached).ExecuteBackgroundCheckpoint(*con.context);
+			}
+			con.Rollback();
+		} catch (...) {
+			// best-effort: if the checkpoint cannot run (e.g. writers are active), it is re-scheduled
+			// when the next commit exceeds the WAL threshold again
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	weak_ptr<DatabaseInstance> instance;
+	string database_name;
+};
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	bool expected = false;
+	if (!background_checkpoint_scheduled.compare_exchange_strong(expected, true)) {
+		// a background checkpoint task is already scheduled
+		return;
+	}
+	auto &db_instance = db.GetDatabase();
+	auto &scheduler = TaskScheduler::GetScheduler(db_instance);
+	{
+		lock_guard<mutex> guard(background_checkpoint_lock);
+		if (!background_checkpoint_producer) {
+			background_checkpoint_producer = scheduler.CreateProducer();
+		}
+	}
+	scheduler.ScheduleTask(*background_checkpoint_producer,
+	                       make_shared_ptr<BackgroundCheckpointTask>(db_instance, db.GetName()));
+}
+
+void DuckTransactionManager::ExecuteBackgroundCheckpoint(ClientContext &context) {
+	// clear the flag first, so that commits during the checkpoint can schedule a follow-up
+	background_checkpoint_scheduled = false;
+	Checkpoint(context, false);
+}
+
 void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	auto &storage_manager = db.GetStorageManager();
 	if (storage_manager.InMemory()) {
@@ -257,6 +317,11 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		// unlock the transaction lock while we write to the WAL
 		t_lock.unlock();
 		// grab the WAL lock and hold it until the entire commit is finished
+		// note that this serializes the WAL sync as well: the flush at the end of the commit still runs
+		// under this lock (and the re-acquired transaction lock), so no second committer can reach the
+		// flush point while one is syncing. Group commit - one fsync covering several transactions -
+		// therefore isn't a batching window here; it requires moving the sync out of both critical
+		// sections and deferring visibility until the shared flush completes
 		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
 		error = transaction.WriteToWAL(db, commit_state);
 
@@ -326,13 +391,22 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
 		D_ASSERT(lock);
-		// we can unlock the transaction lock while checkpointing
-		// checkpoint the database to disk
-		CheckpointOptions options;
-		options.action = CheckpointAction::ALWAYS_CHECKPOINT;
-		options.type = checkpoint_decision.type;
-		auto &storage_manager = db.GetStorageManager();
-		storage_manager.CreateCheckpoint(context, options);
+		auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+		if (DBConfig::GetConfig(db.GetDatabase()).options.background_checkpoint && scheduler.NumberOfThreads() > 1) {
+			// background checkpointing: release the checkpoint lock and hand the checkpoint to a task
+			// scheduler worker, so this commit does not stall on the checkpoint itself. this requires
+			// background worker threads - with a single thread we still checkpoint inline
+			lock.reset();
+			ScheduleBackgroundCheckpoint();
+		} else {
+			// we can unlock the transaction lock while checkpointing
+			// checkpoint the database to disk
+			CheckpointOptions options;
+			options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+			options.type = checkpoint_decision.type;
+			auto &storage_manager = db.GetStorageManager();
+			storage_manager.CreateCheckpoint(context, options);
+		}
 	}
 	return error;
 }
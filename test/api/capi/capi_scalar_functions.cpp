@@ -501,6 +501,77 @@ TEST_CASE("Test Scalar Function with Bind Info", "[capi]") {
 	REQUIRE(first_connection_id != second_connection_id);
 }
 
+struct ConstantMultiplierData {
+	int64_t multiplier;
+};
+
+void MultiplyByConstantBind(duckdb_bind_info info) {
+	REQUIRE(duckdb_scalar_function_bind_get_argument_count(info) == 2);
+
+	// the first argument is a column reference and must not be constant
+	auto non_constant = duckdb_scalar_function_bind_get_constant_argument(info, 0);
+	REQUIRE(non_constant == nullptr);
+	// out-of-range indexes return NULL
+	auto out_of_range = duckdb_scalar_function_bind_get_constant_argument(info, 2);
+	REQUIRE(out_of_range == nullptr);
+
+	// the second argument is a constant - specialize on it once at bind time
+	auto constant = duckdb_scalar_function_bind_get_constant_argument(info, 1);
+	if (!constant) {
+		duckdb_scalar_function_bind_set_error(info, "multiplier must be a constant");
+		return;
+	}
+	auto bind_data = reinterpret_cast<ConstantMultiplierData *>(malloc(sizeof(ConstantMultiplierData)));
+	bind_data->multiplier = duckdb_get_int64(constant);
+	duckdb_destroy_value(&constant);
+	duckdb_scalar_function_set_bind_data(info, bind_data, free);
+}
+
+void MultiplyByConstant(duckdb_function_info info, duckdb_data_chunk input, duckdb_vector output) {
+	auto bind_data = reinterpret_cast<ConstantMultiplierData *>(duckdb_scalar_function_get_bind_data(info));
+	auto input_size = duckdb_data_chunk_get_size(input);
+	auto input_data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(duckdb_data_chunk_get_vector(input, 0)));
+	auto result_data = reinterpret_cast<int64_t *>(duckdb_vector_get_data(output));
+	for (idx_t row_idx = 0; row_idx < input_size; row_idx++) {
+		result_data[row_idx] = input_data[row_idx] * bind_data->multiplier;
+	}
+}
+
+static void CAPIRegisterMultiplyByConstant(duckdb_connection connection) {
+	auto function = duckdb_create_scalar_function();
+	duckdb_scalar_function_set_name(function, "multiply_by_constant");
+
+	auto type = duckdb_create_logical_type(DUCKDB_TYPE_BIGINT);
+	duckdb_scalar_function_add_parameter(function, type);
+	duckdb_scalar_function_add_parameter(function, type);
+	duckdb_scalar_function_set_return_type(function, type);
+	duckdb_destroy_logical_type(&type);
+
+	duckdb_scalar_function_set_bind(function, MultiplyByConstantBind);
+	duckdb_scalar_function_set_function(function, MultiplyByConstant);
+
+	REQUIRE(duckdb_register_scalar_function(connection, function) == DuckDBSuccess);
+	duckdb_destroy_scalar_function(&function);
+}
+
+TEST_CASE("Test Scalar Function constant argument specialization", "[capi]") {
+	CAPITester tester;
+	duckdb::unique_ptr<CAPIResult> result;
+
+	REQUIRE(tester.OpenDatabase(nullptr));
+	CAPIRegisterMultiplyByConstant(tester.connection);
+
+	result = tester.Query("SELECT multiply_by_constant(i, 3) FROM range(100) t(i)");
+	REQUIRE_NO_FAIL(*result);
+	for (idx_t row = 0; row < 100; row++) {
+		REQUIRE(result->Fetch<int64_t>(0, row) == static_cast<int64_t>(row * 3));
+	}
+
+	// a non-constant multiplier is rejected by the bind callback
+	result = tester.Query("SELECT multiply_by_constant(i, i) FROM range(100) t(i)");
+	REQUIRE(result->HasError());
+}
+
 void ListSum(duckdb_function_info, duckdb_data_chunk input, duckdb_vector output) {
 	auto input_vector = duckdb_data_chunk_get_vector(input, 0);
 	auto input_size = duckdb_data_chunk_get_size(input);
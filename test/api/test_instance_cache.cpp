@@ -34,3 +34,35 @@ TEST_CASE("Test parallel connection and destruction of connections with database
 		REQUIRE(1);
 	}
 }
+
+TEST_CASE("Test warm instance pool in the database instance cache", "[api]") {
+	DBInstanceCache instance_cache;
+
+	// pre-create a warm instance
+	DBConfig warm_config;
+	instance_cache.AddWarmInstance(warm_config);
+	REQUIRE(instance_cache.WarmInstanceCount() == 1);
+
+	// opening a database file takes the instance from the pool and attaches the file
+	auto path = TestCreatePath("instance_cache_warm.db");
+	DBConfig config;
+	auto shared_db = instance_cache.GetOrCreateInstance(path, config, true);
+	REQUIRE(instance_cache.WarmInstanceCount() == 0);
+
+	// the attached file is the default database
+	Connection con(*shared_db);
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (42)"));
+	auto result = con.Query("SELECT i FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+
+	// the data ends up in the database file
+	shared_db.reset();
+	auto reopened_db = instance_cache.GetOrCreateInstance(path, config, true);
+	Connection verify_con(*reopened_db);
+	result = verify_con.Query("SELECT i FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+
+	reopened_db.reset();
+	TestDeleteFile(path);
+}
@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/single_file_block_manager.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test memory-mapped read-only databases", "[api]") {
+	auto path = TestCreatePath("mmap_database.db");
+	// create a database file
+	{
+		DuckDB db(path);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE numbers AS SELECT i, 'value_' || i AS s FROM range(100000) t(i)"));
+		REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+	}
+	// re-open it read-only with memory mapping enabled
+	DBConfig config;
+	config.options.access_mode = AccessMode::READ_ONLY;
+	config.options.mmap_database_files = true;
+	DuckDB db(path, &config);
+	Connection con(db);
+
+	auto result = con.Query("SELECT COUNT(*), SUM(i) FROM numbers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(100000)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(4999950000)}));
+
+#ifndef _WIN32
+	// on platforms with an mmap implementation the block manager must actually serve from the map
+	con.BeginTransaction();
+	bool found = false;
+	for (auto &db_ref : DatabaseManager::Get(*db.instance).GetDatabases(*con.context)) {
+		auto &attached = db_ref.get();
+		if (attached.IsSystem() || attached.IsTemporary()) {
+			continue;
+		}
+		auto &block_manager = attached.GetStorageManager().GetBlockManager();
+		auto &sf_block_manager = reinterpret_cast<SingleFileBlockManager &>(block_manager);
+		REQUIRE(sf_block_manager.IsMemoryMapped());
+		found = true;
+	}
+	REQUIRE(found);
+	con.Rollback();
+#endif
+	TestDeleteFile(path);
+}
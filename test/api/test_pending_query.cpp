@@ -244,3 +244,22 @@ TEST_CASE("Test Pending Query Prepared Statements API", "[api][.]") {
 		REQUIRE_THROWS(pending_query->Execute());
 	}
 }
+
+TEST_CASE("Test pending query notify callback", "[api]") {
+	DuckDB db;
+	Connection con(db);
+
+	atomic<idx_t> notify_count {0};
+	auto pending_query = con.PendingQuery("SELECT SUM(i) FROM range(1000000) tbl(i)");
+	REQUIRE(!pending_query->HasError());
+	pending_query->RegisterNotifyCallback([&notify_count]() { notify_count++; });
+
+	// drive the query to completion as an event loop would
+	while (!PendingQueryResult::IsResultReady(pending_query->ExecuteTask())) {
+	}
+	auto result = pending_query->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(499999500000)}));
+
+	// the callback fired at least once per completed pipeline
+	REQUIRE(notify_count.load() >= 1);
+}
@@ -172,6 +172,9 @@ bool OptionIsExcludedFromTest(const string &name) {
 	    "custom_user_agent",
 	    "default_block_size",
 	    "index_scan_percentage",
+	    "scan_resistant_eviction", // cant change this while db is running
+	    "scheduler_numa_aware",    // cant change this while db is running
+	    "use_direct_io",        // cant change this while db is running
 	    "scheduler_process_partial",
 	    "index_scan_max_count"};
 	return excluded_options.count(name) == 1;
@@ -0,0 +1,80 @@
+#include "catch.hpp"
+#include "duckdb/main/appender.hpp"
+#include "test_helpers.hpp"
+
+#include <vector>
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test columnar appends", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER, j BIGINT)"));
+
+	// append caller-owned buffers spanning multiple vectors
+	constexpr idx_t count = 5000;
+	duckdb::vector<int32_t> i_values(count);
+	duckdb::vector<int64_t> j_values(count);
+	for (idx_t i = 0; i < count; i++) {
+		i_values[i] = NumericCast<int32_t>(i);
+		j_values[i] = NumericCast<int64_t>(i * 2);
+	}
+	{
+		Appender appender(con, "integers");
+		duckdb::vector<AppenderColumn> columns(2);
+		columns[0].data = data_ptr_cast(i_values.data());
+		columns[1].data = data_ptr_cast(j_values.data());
+		appender.AppendColumns(columns, count);
+		appender.Close();
+	}
+	result = con.Query("SELECT COUNT(*), SUM(i), SUM(j) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(5000)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(12497500)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {Value::BIGINT(24995000)}));
+}
+
+TEST_CASE("Test columnar appends with validity and strings", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl(i INTEGER, s VARCHAR)"));
+
+	// every odd row is NULL
+	constexpr idx_t count = 100;
+	duckdb::vector<int32_t> i_values(count);
+	duckdb::vector<string_t> s_values(count);
+	duckdb::vector<validity_t> validity(ValidityMask::ValidityMaskSize(count) / sizeof(validity_t), 0);
+	ValidityMask mask(validity.data(), count);
+	for (idx_t i = 0; i < count; i++) {
+		i_values[i] = NumericCast<int32_t>(i);
+		s_values[i] = string_t("short");
+		if (i % 2 == 0) {
+			mask.SetValid(i);
+		}
+	}
+	{
+		Appender appender(con, "tbl");
+		duckdb::vector<AppenderColumn> columns(2);
+		columns[0].data = data_ptr_cast(i_values.data());
+		columns[0].validity = validity.data();
+		columns[1].data = data_ptr_cast(s_values.data());
+		columns[1].validity = validity.data();
+		appender.AppendColumns(columns, count);
+		appender.Close();
+	}
+	result = con.Query("SELECT COUNT(*), COUNT(i), SUM(i), COUNT(s) FROM tbl");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(100)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(50)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {Value::BIGINT(2450)}));
+	REQUIRE(CHECK_COLUMN(result, 3, {Value::BIGINT(50)}));
+
+	// mismatched column counts and nested types are rejected
+	Appender appender(con, "tbl");
+	duckdb::vector<AppenderColumn> columns(1);
+	columns[0].data = data_ptr_cast(i_values.data());
+	REQUIRE_THROWS(appender.AppendColumns(columns, count));
+}